@@ -7,313 +7,3966 @@
 #include <stdlib.h>
 #include <errno.h>
 #include <stdio.h>
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
 #include "CX_Array.h"
 #include "CX_UTest.h"
 #include "CX_ObjectManager.h"
+#include "CX_Parallel.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*! \brief This macro tells whether the buffers of the Array objects can be mapped (see
+ * `CX_ArraySetHugePageThreshold()`).
+ */
+
+#if defined(MAP_ANONYMOUS)
+#define CX_ARRAY_HAVE_MMAP 1
+#else
+#define CX_ARRAY_HAVE_MMAP 0
+#endif
+
+/*! \brief Size, in bytes, of a huge page. The mapped buffers are rounded up to a multiple of this size.
+ */
+
+#define CX_ARRAY_HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+
+/*! \brief Number of elements allocated the first time an element is added to an empty Array object.
+ */
+
+#define CX_ARRAY_INITIAL_CAPACITY 8
+
+/*! \brief Minimum number of elements processed by a thread, for the parallel algorithms.
+ */
+
+#define CX_ARRAY_PARALLEL_GRAIN 4096
+
+/*! \brief Minimum number of elements cloned by a thread (see `CX_ArrayDupParallel()`).
+ *
+ * Cloning an element is much more expensive than comparing it. Thus, this value is lower than
+ * `CX_ARRAY_PARALLEL_GRAIN`.
+ */
+
+#define CX_ARRAY_PARALLEL_CLONE_GRAIN 256
+
+/*! \brief Return the number of bytes used to store one element of a given Array object.
+ */
+
+#define CX_ARRAY_SLOT_SIZE(a) (0 == (a)->elementSize ? sizeof(void*) : (a)->elementSize)
+
+/*! \brief Return the address of the slot that holds the element at a given position within an inline Array object.
+ */
+
+#define CX_ARRAY_VALUE_AT(a, i) ((void*)((char*)(a)->elements + (size_t)(i) * (a)->elementSize))
+
+/*! \brief Return the element at a given position within an Array object (no matter how the Array object stores it).
+ */
+
+#define CX_ARRAY_ELEMENT_AT(a, i) (0 == (a)->elementSize ? (a)->elements[i] : CX_ARRAY_VALUE_AT(a, i))
+
+/*! \brief Alignment, in bytes, of the elements allocated by `CX_ArrayAllocElement()`.
+ */
+
+#define CX_ARRAY_ARENA_ALIGNMENT 16
+
+/*! \brief Size, in bytes, of the first chunk of memory allocated by `CX_ArrayAllocElement()`.
+ */
+
+#define CX_ARRAY_ARENA_MIN_CHUNK_SIZE 4096
+
+/*! \brief Maximum size, in bytes, of a chunk of memory allocated by `CX_ArrayAllocElement()` (unless a larger element
+ * is requested).
+ */
+
+#define CX_ARRAY_ARENA_MAX_CHUNK_SIZE (1024 * 1024)
+
+/*! \brief Round a size up to a multiple of `CX_ARRAY_ARENA_ALIGNMENT`.
+ */
+
+#define CX_ARRAY_ARENA_ALIGN(s) (((s) + CX_ARRAY_ARENA_ALIGNMENT - 1) & ~(size_t)(CX_ARRAY_ARENA_ALIGNMENT - 1))
+
+/*! \brief Size, in bytes, of the header of a chunk of memory allocated by `CX_ArrayAllocElement()`.
+ */
+
+#define CX_ARRAY_ARENA_HEADER_SIZE CX_ARRAY_ARENA_ALIGN(sizeof(struct CX_ArrayArenaChunk))
+
+/*! \brief Test whether an Array object allocates its elements from an arena (see `CX_ArrayCreateArena()`).
+ */
+
+#define CX_ARRAY_IS_ARENA(a) (&_arenaDisposer == (a)->elementDisposer)
+
+/*! \brief The first segment of a concurrent Array object holds `1 << CX_ARRAY_CONCURRENT_FIRST_SEGMENT_BITS` elements.
+ * Each segment holds twice as many elements as the previous one.
+ */
+
+#define CX_ARRAY_CONCURRENT_FIRST_SEGMENT_BITS 6
+
+/*! \brief Maximum number of segments of a concurrent Array object (enough to hold `SIZE_MAX` elements).
+ */
+
+#define CX_ARRAY_CONCURRENT_SEGMENTS (sizeof(size_t) * CHAR_BIT - CX_ARRAY_CONCURRENT_FIRST_SEGMENT_BITS)
+
+/**
+ * @brief The segmented storage of a concurrent Array object (see `CX_ArrayCreateConcurrent()`).
+ *
+ * The segments are never reallocated. Thus, the elements never move. Each segment is made of its slots, followed by
+ * one "ready" flag per slot (see `_concurrentReady()`).
+ */
+
+struct CX_ArrayConcurrentStore {
+    /**
+     * The number of slots reserved by the producers.
+     */
+    size_t reserved;
+    /**
+     * The number of published elements: the length of the sequence of ready slots that starts at position 0. The
+     * elements at positions [0, published[ can be read.
+     */
+    size_t published;
+    /**
+     * The position of the first slot that could not be allocated, or `SIZE_MAX`.
+     */
+    size_t failedAt;
+    /**
+     * The segments. The segment `k` holds the elements at positions [B * (2^k - 1), B * (2^(k+1) - 1)[, where B is the
+     * size of the first segment.
+     */
+    void **segments[CX_ARRAY_CONCURRENT_SEGMENTS];
+};
+
+/*! \brief Signature written at the beginning of a binary image (see `CX_ArraySaveInline()`).
+ */
+
+#define CX_ARRAY_IMAGE_MAGIC "CX_ARRAY"
+
+/*! \brief Version of the format of the binary images.
+ */
+
+#define CX_ARRAY_IMAGE_VERSION 1
+
+/*! \brief Value written in the native byte order, so that an image written on a host with another byte order is
+ * rejected.
+ */
+
+#define CX_ARRAY_IMAGE_BYTE_ORDER 0x01020304
+
+/*! \brief Size, in bytes, of a record of a binary image: the length of the data, the data, the terminating zero, and
+ * the padding (so that the next record is aligned on 8 bytes).
+ */
+
+#define CX_ARRAY_IMAGE_RECORD_SIZE(l) ((sizeof(uint64_t) + (l) + 1 + 7) & ~(size_t)7)
+
+/**
+ * @brief The header of a binary image (see `CX_ArraySaveInline()` and `CX_ArraySaveRecords()`).
+ *
+ * An inline image contains the header, followed by the `count` values (of `elementSize` bytes each).
+ * A records image contains the header, followed by a table of `count` entries (see `struct CX_ArrayImageEntry`),
+ * followed by the records.
+ */
+
+struct CX_ArrayImageHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    /**
+     * The number of elements.
+     */
+    uint64_t count;
+    /**
+     * The size of a value, in bytes, for an inline image. The value 0 means that the image contains records.
+     */
+    uint64_t elementSize;
+};
+
+/**
+ * @brief An entry of the table of a records image.
+ *
+ * The lengths are stored in the table, so that the records are not read when the image is loaded.
+ */
+
+struct CX_ArrayImageEntry {
+    /**
+     * The offset of the record, relative to the beginning of the image.
+     */
+    uint64_t offset;
+    /**
+     * The length of the data of the record.
+     */
+    uint64_t length;
+};
+
+/**
+ * @brief The binary image an Array object has been loaded from (see `CX_ArrayLoadInlineMapped()` and
+ * `CX_ArrayLoadRecordsMapped()`).
+ */
+
+struct CX_ArrayImage {
+    /**
+     * The address of the image, and its size in bytes.
+     */
+    void *address;
+    size_t size;
+    /**
+     * This flag tells whether the image has been mapped (true), or read into a buffer allocated by `malloc()` (false).
+     */
+    bool mapped;
+    /**
+     * For a records image, the descriptors of the records. The elements of the Array object point to these
+     * descriptors.
+     */
+    struct CX_ArrayRecordType *records;
+    /**
+     * The disposer given to the loader. It is only used by the clones of the Array object, since the elements of the
+     * Array object itself belong to the image.
+     */
+    void(*elementDisposer)(void*);
+};
+
+/**
+ * @brief Find the slot that holds the element at a given position within a concurrent Array object.
+ * @param inIndex The position of the element.
+ * @param outSegment Pointer to a memory location used to store the index of the segment.
+ * @param outOffset Pointer to a memory location used to store the position of the slot within the segment.
+ */
+
+static void _concurrentLocate(size_t inIndex, size_t *outSegment, size_t *outOffset) {
+    unsigned long long block = (unsigned long long)(inIndex >> CX_ARRAY_CONCURRENT_FIRST_SEGMENT_BITS) + 1;
+    size_t segment = sizeof(unsigned long long) * CHAR_BIT - 1 - (size_t)__builtin_clzll(block);
+    *outSegment = segment;
+    *outOffset = inIndex - ((((size_t)1 << segment) - 1) << CX_ARRAY_CONCURRENT_FIRST_SEGMENT_BITS);
+}
+
+/**
+ * @brief Return the number of slots of a given segment of a concurrent Array object.
+ * @param inSegment The index of the segment.
+ * @return The function returns the number of slots.
+ */
+
+static size_t _concurrentSegmentSize(size_t inSegment) {
+    return (size_t)1 << (inSegment + CX_ARRAY_CONCURRENT_FIRST_SEGMENT_BITS);
+}
+
+/**
+ * @brief Return the "ready" flags of a given segment of a concurrent Array object.
+ * @param inSlots The slots of the segment.
+ * @param inSegment The index of the segment.
+ * @return The function returns the flags. The flag at position `i` tells whether the slot at position `i` holds an
+ * element.
+ */
+
+static bool *_concurrentReady(void **inSlots, size_t inSegment) {
+    return (bool*)(inSlots + _concurrentSegmentSize(inSegment));
+}
+
+/**
+ * @brief Test whether the slot at a given position within a concurrent Array object holds an element.
+ * @param inStore The segmented storage.
+ * @param inIndex The position of the slot.
+ * @param outElement Pointer to a memory location used to store the element, if the slot holds one.
+ * @return If the slot holds an element, then the function returns the value true. Otherwise, it returns the value
+ * false.
+ */
+
+static bool _concurrentIsReady(struct CX_ArrayConcurrentStore *inStore, size_t inIndex, void **outElement) {
+    size_t segment, offset;
+    _concurrentLocate(inIndex, &segment, &offset);
+    void **slots = __atomic_load_n(&inStore->segments[segment], __ATOMIC_ACQUIRE);
+    if (NULL == slots || ! __atomic_load_n(&_concurrentReady(slots, segment)[offset], __ATOMIC_SEQ_CST)) {
+        return false;
+    }
+    *outElement = slots[offset];
+    return true;
+}
+
+/**
+ * @brief Extend the sequence of published elements of a concurrent Array object over the slots that are ready.
+ *
+ * Any thread may extend the sequence: no thread waits for another one. The thread that makes a slot ready calls this
+ * function after it raised the flag. Thus, either it extends the sequence over its slot, or the thread that extends
+ * the sequence up to this slot sees the flag.
+ * @param inStore The segmented storage.
+ * @return The function returns the number of published elements.
+ */
+
+static size_t _concurrentPublish(struct CX_ArrayConcurrentStore *inStore) {
+    size_t published = __atomic_load_n(&inStore->published, __ATOMIC_SEQ_CST);
+    void *element;
+    while (_concurrentIsReady(inStore, published, &element)) {
+        // Upon failure, another thread has extended the sequence: "published" is updated.
+        if (__atomic_compare_exchange_n(&inStore->published, &published, published + 1, false, __ATOMIC_SEQ_CST,
+                                        __ATOMIC_SEQ_CST)) {
+            published++;
+        }
+    }
+    return published;
+}
+
+/**
+ * @brief Copy the first elements of a concurrent Array object into a contiguous buffer.
+ * @param inStore The segmented storage.
+ * @param inCount The number of elements to copy. These elements must have been published.
+ * @param outElements The buffer.
+ */
+
+static void _concurrentCopy(struct CX_ArrayConcurrentStore *inStore, size_t inCount, void **outElements) {
+    for (size_t segment=0, copied=0; copied < inCount; segment++) {
+        size_t count = _concurrentSegmentSize(segment);
+        if (count > inCount - copied) {
+            count = inCount - copied;
+        }
+        memcpy(outElements + copied, __atomic_load_n(&inStore->segments[segment], __ATOMIC_ACQUIRE),
+               sizeof(void*) * count);
+        copied += count;
+    }
+}
+
+/**
+ * @brief Free the segmented storage of a given concurrent Array object.
+ * @param inArray The Array object.
+ * @param inDispose This flag tells whether the published elements should be disposed or not.
+ */
+
+static void _freeConcurrent(CX_Array inArray, bool inDispose) {
+    struct CX_ArrayConcurrentStore *store = inArray->concurrent;
+    if (NULL == store) {
+        return;
+    }
+    if (inDispose && NULL != inArray->elementDisposer) {
+        // If the process ran out of memory, then ready slots may follow the published elements.
+        void *element;
+        for (size_t i=0; i<store->reserved; i++) {
+            if (_concurrentIsReady(store, i, &element)) {
+                inArray->elementDisposer(element);
+            }
+        }
+    }
+    for (size_t segment=0; segment<CX_ARRAY_CONCURRENT_SEGMENTS; segment++) {
+        free(store->segments[segment]);
+    }
+    free(store);
+    inArray->concurrent = NULL;
+}
+
+/**
+ * @brief A chunk of memory used to allocate the elements of an arena Array object (see `CX_ArrayCreateArena()`).
+ *
+ * The elements are allocated right after the header of the chunk.
+ */
+
+struct CX_ArrayArenaChunk {
+    /**
+     * The chunk allocated before this one, or NULL.
+     */
+    struct CX_ArrayArenaChunk *previous;
+    /**
+     * The number of bytes available for elements.
+     */
+    size_t size;
+    /**
+     * The number of bytes already allocated.
+     */
+    size_t used;
+};
+
+/**
+ * @brief Return the address of the buffer allocated for a given Array object.
+ * @param inArray The Array object.
+ * @return The function returns the address of the buffer (which may precede the first element, see
+ * `CX_ArrayCreateDeque()`), or the value NULL if no buffer has been allocated.
+ */
+
+static void *_buffer(CX_Array inArray) {
+    if (NULL == inArray->elements) {
+        return NULL;
+    }
+    return (char*)inArray->elements - inArray->front * CX_ARRAY_SLOT_SIZE(inArray);
+}
+
+/**
+ * @brief Return the maximum number of slots of the buffer of a given Array object.
+ * @param inArray The Array object.
+ * @return The function returns the maximum number of slots, so that the size of the buffer, in bytes, can be
+ * represented by a `size_t`.
+ */
+
+static size_t _maxSlots(CX_Array inArray) {
+    return SIZE_MAX / CX_ARRAY_SLOT_SIZE(inArray);
+}
+
+/**
+ * @brief Test whether a buffer of a given size should be backed by huge pages (see `CX_ArraySetHugePageThreshold()`).
+ * @param inArray The Array object.
+ * @param inSize The size of the buffer, in bytes.
+ * @return The function returns the value true if the buffer should be mapped. Otherwise, it returns the value false.
+ */
+
+static bool _useHugePages(CX_Array inArray, size_t inSize) {
+#if CX_ARRAY_HAVE_MMAP
+    return 0 != inArray->hugePageThreshold && inSize >= inArray->hugePageThreshold;
+#else
+    (void)inArray;
+    (void)inSize;
+    return false;
+#endif
+}
+
+/**
+ * @brief Allocate a buffer for a given Array object.
+ *
+ * Large buffers are mapped, and backed by huge pages, if the Array object requests it (see
+ * `CX_ArraySetHugePageThreshold()`). Other buffers are allocated with `malloc()`.
+ * @param inArray The Array object.
+ * @param inSize The size of the buffer, in bytes.
+ * @param outMapped Pointer to a memory location used to store the size of the mapping (or 0 if the buffer has been
+ * allocated with `malloc()`).
+ * @return Upon successful completion the function returns a pointer to the buffer.
+ * Otherwise, it returns the value NULL (which means that the process ran out of memory).
+ */
+
+static void *_allocBuffer(CX_Array inArray, size_t inSize, size_t *outMapped) {
+    *outMapped = 0;
+#if CX_ARRAY_HAVE_MMAP
+    if (_useHugePages(inArray, inSize) && inSize <= SIZE_MAX - CX_ARRAY_HUGE_PAGE_SIZE) {
+        size_t length = (inSize + CX_ARRAY_HUGE_PAGE_SIZE - 1) / CX_ARRAY_HUGE_PAGE_SIZE * CX_ARRAY_HUGE_PAGE_SIZE;
+        void *buffer = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED == buffer) {
+            return NULL;
+        }
+#ifdef MADV_HUGEPAGE
+        // This is only a hint: the kernel may not support transparent huge pages.
+        madvise(buffer, length, MADV_HUGEPAGE);
+#endif
+        *outMapped = length;
+        return buffer;
+    }
+#endif
+    return malloc(inSize);
+}
+
+/**
+ * @brief Test whether a given buffer has been allocated for a given Array object (and, thus, must be freed with it).
+ * @param inArray The Array object.
+ * @param inBuffer The buffer.
+ * @return The function returns the value false if the buffer is the small buffer of the Array object, or if it lies
+ * within the image the Array object has been loaded from. Otherwise, it returns the value true.
+ */
+
+static bool _ownsBuffer(CX_Array inArray, void *inBuffer) {
+    if (inBuffer == (void*)inArray->small) {
+        return false;
+    }
+    if (NULL != inArray->image) {
+        char *address = (char*)inArray->image->address;
+        return (char*)inBuffer < address || (char*)inBuffer >= address + inArray->image->size;
+    }
+    return true;
+}
+
+/**
+ * @brief Free a buffer allocated by `_allocBuffer()`.
+ * @param inArray The Array object the buffer belongs to.
+ * @param inBuffer The buffer. This value may be NULL, the small buffer of the Array object, or a buffer within the
+ * image the Array object has been loaded from (which are not freed).
+ * @param inMapped The size of the mapping (or 0 if the buffer has been allocated with `malloc()`).
+ */
+
+static void _freeBuffer(CX_Array inArray, void *inBuffer, size_t inMapped) {
+    if (! _ownsBuffer(inArray, inBuffer)) {
+        return;
+    }
+#if CX_ARRAY_HAVE_MMAP
+    if (0 != inMapped) {
+        munmap(inBuffer, inMapped);
+        return;
+    }
+#else
+    (void)inMapped;
+#endif
+    free(inBuffer);
+}
+
+/**
+ * @brief Release a binary image (see `CX_ArrayLoadInlineMapped()` and `CX_ArrayLoadRecordsMapped()`).
+ * @param inImage The image. This value may be NULL.
+ */
+
+static void _freeImage(struct CX_ArrayImage *inImage) {
+    if (NULL == inImage) {
+        return;
+    }
+#if CX_ARRAY_HAVE_MMAP
+    if (inImage->mapped) {
+        munmap(inImage->address, inImage->size);
+    } else {
+        free(inImage->address);
+    }
+#else
+    free(inImage->address);
+#endif
+    free(inImage->records);
+    free(inImage);
+}
+
+/**
+ * @brief Return the number of elements that fit into the small buffer of a given Array object.
+ * @param inArray The Array object.
+ * @return The function returns the number of elements, or 0 if the Array object does not use its small buffer (see
+ * `struct CX_ArrayType`).
+ */
+
+static size_t _smallCapacity(CX_Array inArray) {
+    size_t slotSize = CX_ARRAY_SLOT_SIZE(inArray);
+    if (inArray->deque || slotSize > sizeof(void*)) {
+        return 0;
+    }
+    return sizeof(inArray->small) / slotSize;
+}
+
+/**
+ * @brief Set the capacity of a given Array object.
+ *
+ * The buffer that holds the elements is reallocated so that it can hold exactly `inCapacity` elements.
+ * @param inArray The Array object.
+ * @param inCapacity The new capacity. It must be greater than, or equal to, the number of elements in the Array object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the Array
+ * object is left untouched.
+ */
+
+static bool _setCapacity(CX_Array inArray, size_t inCapacity) {
+    void *buffer = _buffer(inArray);
+    if (0 == inCapacity) {
+        _freeBuffer(inArray, buffer, inArray->mapped);
+        inArray->elements = NULL;
+        inArray->capacity = 0;
+        inArray->front = 0;
+        inArray->mapped = 0;
+        return true;
+    }
+    if (0 == inArray->front && inCapacity <= _smallCapacity(inArray)) {
+        // The elements fit into the small buffer.
+        if (buffer != (void*)inArray->small) {
+            if (inArray->count > 0) {
+                memcpy(inArray->small, inArray->elements, CX_ARRAY_SLOT_SIZE(inArray) * inArray->count);
+            }
+            _freeBuffer(inArray, buffer, inArray->mapped);
+            inArray->elements = inArray->small;
+            inArray->mapped = 0;
+        }
+        inArray->capacity = inCapacity;
+        return true;
+    }
+    if (inCapacity > _maxSlots(inArray) - inArray->front) {
+        return false;
+    }
+    size_t slotSize = CX_ARRAY_SLOT_SIZE(inArray);
+    size_t size = slotSize * (inArray->front + inCapacity);
+    bool mapped = _useHugePages(inArray, size);
+    char *newBuffer;
+
+    if (0 == inArray->mapped && ! mapped && _ownsBuffer(inArray, buffer)) {
+        newBuffer = (char*)realloc(buffer, size);
+        if (NULL == newBuffer) {
+            return false;
+        }
+    } else if (0 != inArray->mapped && mapped && size <= inArray->mapped) {
+        // The mapping is large enough.
+        newBuffer = (char*)buffer;
+    } else {
+        size_t mappedSize;
+        newBuffer = (char*)_allocBuffer(inArray, size, &mappedSize);
+        if (NULL == newBuffer) {
+            return false;
+        }
+        if (inArray->count > 0) {
+            memcpy(newBuffer + slotSize * inArray->front, inArray->elements, slotSize * inArray->count);
+        }
+        _freeBuffer(inArray, buffer, inArray->mapped);
+        inArray->mapped = mappedSize;
+    }
+    inArray->elements = (void**)(newBuffer + slotSize * inArray->front);
+    inArray->capacity = inCapacity;
+    return true;
+}
+
+/**
+ * @brief Move the elements of a given deque Array object to a new buffer, so that free slots are available at both
+ * ends.
+ *
+ * The new buffer is twice as large as needed, and the free slots are shared between both ends. Thus, the number of
+ * elements that can be inserted at either end before the next reallocation is proportional to the number of elements,
+ * and inserting an element at either end costs O(1) amortized.
+ * @param inArray The deque Array object.
+ * @param inFront The minimum number of free slots before the first element.
+ * @param inBack The minimum number of free slots after the last element.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the Array
+ * object is left untouched.
+ */
+
+static bool _recenter(CX_Array inArray, size_t inFront, size_t inBack) {
+    size_t maxSlots = _maxSlots(inArray);
+    if (inFront > maxSlots - inArray->count || inBack > maxSlots - inArray->count - inFront) {
+        return false;
+    }
+    size_t needed = inArray->count + inFront + inBack;
+    size_t total = needed < CX_ARRAY_INITIAL_CAPACITY / 2 ? CX_ARRAY_INITIAL_CAPACITY :
+            (needed > maxSlots / 2 ? maxSlots : needed * 2);
+    size_t front = inFront + (total - needed) / 2;
+
+    size_t slotSize = CX_ARRAY_SLOT_SIZE(inArray);
+    size_t mapped;
+    char *buffer = (char*)_allocBuffer(inArray, slotSize * total, &mapped);
+    if (NULL == buffer) {
+        return false;
+    }
+    if (inArray->count > 0) {
+        memcpy(buffer + slotSize * front, inArray->elements, slotSize * inArray->count);
+    }
+    _freeBuffer(inArray, _buffer(inArray), inArray->mapped);
+    inArray->elements = (void**)(buffer + slotSize * front);
+    inArray->front = front;
+    inArray->capacity = total - front;
+    inArray->mapped = mapped;
+    return true;
+}
+
+/**
+ * @brief Make sure that a given Array object can hold a given number of elements.
+ *
+ * If the buffer must be enlarged, then its capacity is (at least) doubled. Thus, adding N elements, one by one, to an
+ * Array object costs O(N) amortized.
+ * @param inArray The Array object.
+ * @param inMinCapacity The minimum number of elements the Array object must be able to hold.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the Array
+ * object is left untouched.
+ */
+
+static bool _grow(CX_Array inArray, size_t inMinCapacity) {
+    if (inMinCapacity <= inArray->capacity) {
+        return true;
+    }
+    if (inArray->deque) {
+        return _recenter(inArray, 0, inMinCapacity - inArray->count);
+    }
+    size_t maxCapacity = _maxSlots(inArray) - inArray->front;
+    if (inMinCapacity > maxCapacity) {
+        return false;
+    }
+    size_t capacity = inArray->capacity;
+    if (capacity < CX_ARRAY_INITIAL_CAPACITY) {
+        capacity = inMinCapacity <= _smallCapacity(inArray) ? _smallCapacity(inArray) : CX_ARRAY_INITIAL_CAPACITY;
+    }
+    while (capacity < inMinCapacity) {
+        capacity = capacity > maxCapacity / 2 ? maxCapacity : capacity * 2;
+    }
+    return _setCapacity(inArray, capacity);
+}
+
+/**
+ * @brief The disposer of the elements of an arena Array object.
+ *
+ * The elements of an arena Array object are not disposed one by one: they are released all at once, with the arena.
+ * @param inElement The element.
+ */
+
+static void _arenaDisposer(void *inElement) {
+    (void)inElement;
+}
+
+/**
+ * @brief The disposer of the elements of an Array object loaded from a records image.
+ *
+ * The elements belong to the image: they are released all at once, with the image.
+ * @param inElement The element.
+ */
+
+static void _imageDisposer(void *inElement) {
+    (void)inElement;
+}
+
+/**
+ * @brief Return the disposer of the elements of a clone of a given Array object.
+ * @param inArray The Array object.
+ * @return The function returns the disposer given at the array creation, or, if the Array object has been loaded from
+ * an image, the disposer given to the loader (the cloned elements do not belong to the image).
+ */
+
+static void (*_cloneDisposer(CX_Array inArray))(void*) {
+    return NULL == inArray->image ? inArray->elementDisposer : inArray->image->elementDisposer;
+}
+
+/**
+ * @brief Free the chunks of memory allocated by `CX_ArrayAllocElement()` for a given Array object.
+ * @param inArray The Array object.
+ */
+
+static void _freeArena(CX_Array inArray) {
+    struct CX_ArrayArenaChunk *chunk = inArray->arena;
+    while (NULL != chunk) {
+        struct CX_ArrayArenaChunk *previous = chunk->previous;
+        free(chunk);
+        chunk = previous;
+    }
+    inArray->arena = NULL;
+}
+
+/**
+ * @brief Dispose all the elements of a given Array object, using the function provided at the array creation (if any).
+ * @param inArray The Array object.
+ */
+
+static void _disposeElements(CX_Array inArray) {
+    if (NULL == inArray->elementDisposer || CX_ARRAY_IS_ARENA(inArray)) {
+        return;
+    }
+    for (size_t i=0; i<inArray->count; i++) {
+        inArray->elementDisposer(CX_ARRAY_ELEMENT_AT(inArray, i));
+    }
+}
+
+/**
+ * @brief Make sure that a given Array object does not share its buffer with other Array objects, so that it can be
+ * modified.
+ *
+ * If the buffer is shared (see `CX_ArraySetCopyOnWrite()`), then the Array object gets its own copy of the buffer:
+ * - If the Array object stores pointers, then the elements are cloned, using the function provided at the array
+ *   creation. If no such function was provided, then the pointers are copied.
+ * - If the Array object is an inline Array object, then the values are copied byte by byte.
+ *
+ * The other Array objects keep the original elements.
+ * @param inArray The Array object.
+ * @param outStatus The Status object. This value may be NULL.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory, or that an element could not
+ * be cloned). In this case, the Array object is left untouched.
+ */
+
+static bool _unshare(CX_Array inArray, CX_Status outStatus) {
+    unsigned int *shared = inArray->shared;
+    if (NULL == shared) {
+        return true;
+    }
+    if (1 == __atomic_load_n(shared, __ATOMIC_ACQUIRE)) {
+        // All the other Array objects that shared the buffer have been disposed.
+        free(shared);
+        inArray->shared = NULL;
+        return true;
+    }
+
+    size_t slotSize = CX_ARRAY_SLOT_SIZE(inArray);
+    size_t mapped = 0;
+    void **elements = inArray->capacity <= _smallCapacity(inArray) ? inArray->small :
+            (void**)_allocBuffer(inArray, slotSize * (0 == inArray->capacity ? 1 : inArray->capacity), &mapped);
+    if (NULL == elements) {
+        if (NULL != outStatus) {
+            CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        }
+        return false;
+    }
+
+    if (0 == inArray->elementSize && NULL != inArray->elementCloner) {
+        CX_Status status = NULL == outStatus ? CX_StatusCreate() : outStatus;
+        size_t cloned = 0;
+        if (NULL != status) {
+            for (; cloned<inArray->count; cloned++) {
+                elements[cloned] = inArray->elementCloner(inArray->elements[cloned], status);
+                if (NULL == elements[cloned]) {
+                    break;
+                }
+            }
+        }
+        if (status != outStatus && NULL != status) {
+            CX_StatusDispose(status);
+        }
+        if (NULL == status || cloned < inArray->count) {
+            // If set, the status has been set by the cloner.
+            for (size_t i=0; i<cloned && NULL != inArray->elementDisposer; i++) {
+                inArray->elementDisposer(elements[i]);
+            }
+            _freeBuffer(inArray, elements, mapped);
+            return false;
+        }
+    } else if (inArray->count > 0) {
+        memcpy(elements, inArray->elements, slotSize * inArray->count);
+    }
+
+    if (0 == __atomic_sub_fetch(shared, 1, __ATOMIC_ACQ_REL)) {
+        // Meanwhile, all the other Array objects have been disposed. Thus, the original elements must be released.
+        _disposeElements(inArray);
+        _freeBuffer(inArray, _buffer(inArray), inArray->mapped);
+        free(shared);
+    }
+    inArray->elements = elements;
+    inArray->front = 0;
+    inArray->mapped = mapped;
+    inArray->shared = NULL;
+    return true;
+}
+
+/**
+ * @brief Insert uninitialised slots at a given position within a given Array object.
+ *
+ * The elements that follow the position are moved toward the end of the buffer. However, if the Array object is a
+ * deque (see `CX_ArrayCreateDeque()`) and if less elements precede the position, then these elements are moved toward
+ * the beginning of the buffer instead.
+ * @param inArray The Array object.
+ * @param inIndex The position of the first inserted slot. It must be lower than, or equal to, the number of elements.
+ * @param inCount The number of slots to insert.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the Array
+ * object is left untouched.
+ */
+
+static bool _openGap(CX_Array inArray, size_t inIndex, size_t inCount) {
+    size_t slotSize = CX_ARRAY_SLOT_SIZE(inArray);
+    if (inArray->deque && inIndex < inArray->count - inIndex) {
+        if (inArray->front < inCount && ! _recenter(inArray, inCount, 0)) {
+            return false;
+        }
+        char *position = (char*)inArray->elements;
+        memmove(position - slotSize * inCount, position, slotSize * inIndex);
+        inArray->elements = (void**)(position - slotSize * inCount);
+        inArray->front -= inCount;
+        inArray->capacity += inCount;
+    } else {
+        if (! _grow(inArray, inArray->count + inCount)) {
+            return false;
+        }
+        char *position = (char*)inArray->elements + slotSize * inIndex;
+        memmove(position + slotSize * inCount, position, slotSize * (inArray->count - inIndex));
+    }
+    inArray->count += inCount;
+    return true;
+}
+
+/**
+ * @brief Remove slots from a given Array object.
+ *
+ * The elements that follow the removed slots are moved toward the beginning of the buffer. However, if the Array
+ * object is a deque (see `CX_ArrayCreateDeque()`) and if less elements precede the removed slots, then these elements
+ * are moved toward the end of the buffer instead.
+ * @param inArray The Array object.
+ * @param inIndex The position of the first slot to remove.
+ * @param inCount The number of slots to remove. The range must be valid.
+ * @note The elements held by the removed slots are not disposed.
+ */
+
+static void _closeGap(CX_Array inArray, size_t inIndex, size_t inCount) {
+    size_t slotSize = CX_ARRAY_SLOT_SIZE(inArray);
+    if (inArray->deque && inIndex < inArray->count - inIndex - inCount) {
+        char *position = (char*)inArray->elements;
+        memmove(position + slotSize * inCount, position, slotSize * inIndex);
+        inArray->elements = (void**)(position + slotSize * inCount);
+        inArray->front += inCount;
+        inArray->capacity -= inCount;
+    } else {
+        char *position = (char*)inArray->elements + slotSize * inIndex;
+        memmove(position, position + slotSize * inCount, slotSize * (inArray->count - inIndex - inCount));
+    }
+    inArray->count -= inCount;
+}
+
+/**
+ * @brief Create a new Array object.
+ * @param elementDisposer Pointer to a function used to free an element of the Array object.
+ * The signature of this function is:  void elementDisposer (void *element)
+ *    Where:
+ *    - "element" is a pointer to the element to free.
+ * If the elements don't need to be freed (or should not), then you should pass the value NULL for this parameter.
+ * @return elementCloner  Pointer to a function used to clone an element of the Array object.
+ * The signature of this function is:  void* elementCloner (void *element, CX_Status status)
+ *    Where:
+ *    - "element" is a pointer to the element to free.
+ *    - "status" is a status container.
+ *    The function must return a pointer to a clone of the given element.
+ *    Upon successful completion the function must return a pointer to the cloned element.
+ *    Otherwise, the function must return the value NULL.
+ * @return The function returns a new dynamic array.
+ * @warning Please keep in minf that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`.
+ */
+CX_Array CX_ArrayCreate(void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status)) {
+    CX_Array array = (CX_Array)malloc(sizeof(struct CX_ArrayType));
+    if (NULL == array) {
+        return NULL;
+    }
+    array->elements = NULL;
+    array->count = 0;
+    array->capacity = 0;
+    array->elementSize = 0;
+    array->front = 0;
+    array->deque = false;
+    array->mapped = 0;
+    array->hugePageThreshold = 0;
+    array->elementDisposer = elementDisposer;
+    array->elementCloner = elementCloner;
+    array->copyOnWrite = false;
+    array->shared = NULL;
+    array->arena = NULL;
+    array->concurrent = NULL;
+    array->image = NULL;
+    return array;
+}
+
+/**
+ * @brief Free all resources allocated for a given Array object.
+ * @param inArray The Array object to free.
+ */
+void CX_ArrayDispose(CX_Array inArray) {
+    if (NULL != inArray->shared) {
+        if (0 != __atomic_sub_fetch(inArray->shared, 1, __ATOMIC_ACQ_REL)) {
+            // Other Array objects still use the elements.
+            free(inArray);
+            return;
+        }
+        free(inArray->shared);
+    }
+    _disposeElements(inArray);
+    _freeConcurrent(inArray, true);
+    _freeArena(inArray);
+    _freeBuffer(inArray, _buffer(inArray), inArray->mapped);
+    _freeImage(inArray->image);
+    free(inArray);
+}
+
+/**
+ * @brief Return the number of elements in the Array object.
+ * @param inArray The Array object we want to get the number of elements from.
+ * @return The function returns the number of elements in the given Array object.
+ */
+size_t CX_ArrayGetCount(CX_Array inArray) {
+    return inArray->count;
+}
+
+/**
+ * @brief Returns an array that contains the elements of a given Array object.
+ * @param inArray the Array object.
+ * @return The function returns a pointer to an array that contains the elements of a given Array object.
+ */
+
+void **CX_ArrayGetElements(CX_Array inArray) {
+    return inArray->elements;
+}
+
+/**
+ * @brief Clone a given inline Array object.
+ * @param inArray The inline Array object to clone.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a clone of the given Array object.
+ * Otherwise the function returns the value NULL.
+ * @note This function is used by the function `CX_ArrayDup()`.
+ */
+
+static CX_Array _dupInline(CX_Array inArray, CX_Status outStatus) {
+    if (NULL != inArray->elementDisposer) {
+        CX_StatusSetError(outStatus, 0, "Cannot clone an inline array which values must be disposed!");
+        return NULL;
+    }
+    CX_Array clone = CX_ArrayCreateInline(inArray->elementSize, NULL);
+    if (NULL == clone) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    clone->deque = inArray->deque;
+    clone->hugePageThreshold = inArray->hugePageThreshold;
+    if (! _setCapacity(clone, inArray->count)) {
+        CX_ArrayDispose(clone);
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    if (inArray->count > 0) {
+        memcpy(clone->elements, inArray->elements, inArray->elementSize * inArray->count);
+    }
+    clone->count = inArray->count;
+    return clone;
+}
+
+/**
+ * @brief Create an Array object that shares the buffer of a given Array object.
+ * @param inArray The Array object to clone.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a clone of the given Array object.
+ * Otherwise the function returns the value NULL.
+ * @note This function is used by the function `CX_ArrayDup()`.
+ */
+
+static CX_Array _dupShared(CX_Array inArray, CX_Status outStatus) {
+    CX_Array clone = (CX_Array)malloc(sizeof(struct CX_ArrayType));
+    if (NULL == clone) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    if (NULL == inArray->shared) {
+        inArray->shared = (unsigned int*)malloc(sizeof(unsigned int));
+        if (NULL == inArray->shared) {
+            free(clone);
+            CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+            return NULL;
+        }
+        *inArray->shared = 1;
+    }
+    __atomic_add_fetch(inArray->shared, 1, __ATOMIC_RELAXED);
+    *clone = *inArray;
+    if (inArray->elements == inArray->small && ! _unshare(clone, outStatus)) {
+        // The small buffer of the given Array object cannot be shared: the clone must copy it right away.
+        __atomic_sub_fetch(inArray->shared, 1, __ATOMIC_RELAXED);
+        free(clone);
+        return NULL;
+    }
+    return clone;
+}
+
+/**
+ * @brief Clone a given Array object.
+ * @param inArray The Array object to clone.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a clone of the given Array object.
+ * Otherwise the function returns the value NULL (which means that the process runs out of memory).
+ * @warning Please keep in minf that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`.
+ * @note The values of an inline Array object (see `CX_ArrayCreateInline()`) are copied byte by byte. Therefore, an
+ * inline Array object that has a disposer (which means that its values reference resources) cannot be cloned.
+ * @note If the copy-on-write mode is enabled (see `CX_ArraySetCopyOnWrite()`), then the elements are not cloned: the
+ * clone shares the elements of the given Array object, until one of them is modified. However, an Array object which
+ * elements have a disposer but no cloner is cloned as usual (which fails, unless it is empty): otherwise, the elements
+ * would be disposed twice.
+ * @note A non-empty Array object which elements have no cloner cannot be cloned.
+ * @note An arena Array object (see `CX_ArrayCreateArena()`) cannot be cloned.
+ * @note A concurrent Array object (see `CX_ArrayCreateConcurrent()`) cannot be cloned until it has been sealed (see
+ * `CX_ArrayConcurrentSeal()`).
+ */
+CX_Array CX_ArrayDup(CX_Array inArray, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (CX_ARRAY_IS_ARENA(inArray)) {
+        CX_StatusSetError(outStatus, 0, "Cannot clone an array which elements are allocated from an arena!");
+        return NULL;
+    }
+    if (NULL != inArray->concurrent) {
+        CX_StatusSetError(outStatus, 0, "Cannot clone a concurrent array which has not been sealed!");
+        return NULL;
+    }
+    // The shared elements must not be disposed twice: an Array object that owns them must be able to clone them.
+    if (inArray->copyOnWrite && NULL == inArray->image &&
+        (NULL == inArray->elementDisposer || (0 == inArray->elementSize && NULL != inArray->elementCloner))) {
+        return _dupShared(inArray, outStatus);
+    }
+    if (0 != inArray->elementSize) {
+        return _dupInline(inArray, outStatus);
+    }
+    if (NULL == inArray->elementCloner && inArray->count > 0) {
+        CX_StatusSetError(outStatus, 0, "Cannot clone an array which has no function to clone its elements!");
+        return NULL;
+    }
+    CX_ObjectManager m = CX_ObjectManagerCreate();
+
+    CX_Array clone = CX_ArrayCreate(_cloneDisposer(inArray), inArray->elementCloner); // To free
+    if (NULL == clone) {
+        CX_ObjectManagerDisposeOnError(m);
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    CX_OBJECT_MANAGER_ADD_RESULT(m, clone, CX_ArrayDispose);
+    clone->deque = inArray->deque;
+    clone->hugePageThreshold = inArray->hugePageThreshold;
+
+    if (! _setCapacity(clone, inArray->count)) {
+        CX_ObjectManagerDisposeOnError(m);
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+
+    for (size_t i=0; i < CX_ArrayGetCount(inArray); i++) {
+        void *element = CX_ArrayGetElementAt(inArray, i);
+        // clonedElement must not be disposed!
+        void *clonedElement = inArray->elementCloner(element, outStatus);
+        if (NULL == clonedElement) {
+            // The status is set.
+            CX_ObjectManagerDisposeOnError(m);
+            return NULL;
+        }
+
+        if (NULL == CX_ArrayAdd(clone, clonedElement)) {
+            // The status is set.
+            CX_ObjectManagerDisposeOnError(m);
+            CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+            return NULL;
+        }
+    }
+    CX_ObjectManagerDispose(m);
+    return clone;
+}
+
+/**
+ * @brief Test whether a given Array object stores pointers (rather than values).
+ * @param inArray The Array object.
+ * @param inValueFunction The name of the function that must be used for an inline Array object.
+ * @param outStatus The Status object. The value NULL means that no error is reported.
+ * @return If the Array object stores pointers, then the function returns the value true. Otherwise (which means that
+ * it is an inline Array object), it returns the value false.
+ */
+
+static bool _storesPointers(CX_Array inArray, const char *inValueFunction, CX_Status outStatus) {
+    if (0 == inArray->elementSize) {
+        return true;
+    }
+    if (NULL != outStatus) {
+        CX_StatusSetError(outStatus, 0, "This function cannot be used with an inline array: use %s() instead!",
+                          inValueFunction);
+    }
+    return false;
+}
+
+/**
+ * @brief Test whether a given Array object stores values (rather than pointers).
+ * @param inArray The Array object.
+ * @param inPointerFunction The name of the function that must be used for an Array object that stores pointers.
+ * @param outStatus The Status object. The value NULL means that no error is reported.
+ * @return If the Array object is an inline Array object, then the function returns the value true. Otherwise (which
+ * means that it stores pointers), it returns the value false.
+ */
+
+static bool _storesValues(CX_Array inArray, const char *inPointerFunction, CX_Status outStatus) {
+    if (0 != inArray->elementSize) {
+        return true;
+    }
+    if (NULL != outStatus) {
+        CX_StatusSetError(outStatus, 0, "This function can only be used with an inline array: use %s() instead!",
+                          inPointerFunction);
+    }
+    return false;
+}
+
+/**
+ * @brief Returns the element positioned at a given position within a given Array object.
+ * @param inArray The Array object.
+ * @param inIndex The position within the Array object.
+ * @return Upon successful completion the function returns a pointer to the element.
+ * Otherwise, the function returns the value NULL. This means that the given index is not valid (greater or equal to the
+ * total number of elements in the Array object).
+ * @note Please note that the first element of the Array object is located at the index 0.
+ * @note If the Array object is an inline Array object (see `CX_ArrayCreateInline()`), then the function returns a
+ * pointer to the value (as `CX_ArrayGetValueAt()` does).
+ */
+void *CX_ArrayGetElementAt(CX_Array inArray, size_t inIndex) {
+    if (inIndex >= inArray->count) {
+        return NULL;
+    }
+    return CX_ARRAY_ELEMENT_AT(inArray, inIndex);
+}
+
+/**
+ * @brief Add an element at the end of a given Array object.
+ * @param inArray The Array object.
+ * @param inElement A pointer to the element to add to the end of the Array object.
+ * Please note that the added element is not cloned!
+ * @return Upon successful completion the function returns a pointer to the element added element (that is, it returns
+ * the value of `inElement`). Otherwise, the function returns the value NULL. This means that the system could not
+ * allocate memory, or that the Array object is an inline Array object (use `CX_ArrayAddValue()` instead).
+ */
+void *CX_ArrayAdd(CX_Array inArray, void *inElement) {
+    if (! _storesPointers(inArray, "CX_ArrayAddValue", NULL) || ! _unshare(inArray, NULL) ||
+        ! _grow(inArray, inArray->count + 1) CX_UTEST_FORCE_TRUE(1)) {
+        return NULL;
+    }
+    *(inArray->elements + inArray->count) = inElement;
+    inArray->count += 1;
+    return inElement;
+}
+
+/**
+ * @brief Remove an element located to a given position within a given Array object.
+ * @param inArray The Array object.
+ * @param inIndex The position where the element will be inserted.
+ * @param inFree This flag tells the function whether the removed element should be freed or not.
+ * If the value of this parameter is true, then the removed element will be freed, using the function provided at the
+ * array creation (see function CX_ArrayCreate()).
+ * @param outStatus The Status object.
+ * @return In order to test the status of the operation, you must examine the Status object outStatus.
+ * @note Please note that the first element of the Array object is located at the index 0.
+ * @note The capacity of the Array object is not reduced. Call `CX_ArrayShrinkToFit()` to release unused memory.
+ * @note This function cannot be used with an inline Array object (use `CX_ArrayRemoveValue()` instead).
+ */
+void *CX_ArrayRemove(CX_Array inArray, size_t inIndex, bool inFree, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _storesPointers(inArray, "CX_ArrayRemoveValue", outStatus)) {
+        return NULL;
+    }
+    if (inIndex >= inArray->count) {
+        CX_StatusSetError(outStatus, 0, "The given index (%zu) exceeds the number of elements in the array (%zu).",
+                          inIndex, inArray->count);
+        return NULL;
+    }
+    if (! _unshare(inArray, outStatus)) {
+        return NULL;
+    }
+
+    void *element = inArray->elements[inIndex];
+    _closeGap(inArray, inIndex, 1);
+
+    if (inFree) {
+        if (NULL == inArray->elementDisposer) {
+            CX_StatusSetError(outStatus, 0,
+                              "The element should be freed, but no disposer dunction is specified for this array!");
+            return NULL;
+        }
+        inArray->elementDisposer(element);
+        element = NULL;
+    }
+
+    return element;
+}
+
+/**
+ * @brief Remove an element located at a given position within a given Array object, without preserving the order
+ * of the elements: the last element is moved to the position of the removed one.
+ *
+ * Unlike `CX_ArrayRemove()`, which shifts all the elements that follow the removed one, this function costs O(1).
+ * @param inArray The Array object.
+ * @param inIndex The position of the element to remove.
+ * @param inFree This flag tells the function whether the removed element should be freed or not.
+ * If the value of this parameter is true, then the removed element will be freed, using the function provided at the
+ * array creation (see function CX_ArrayCreate()).
+ * @param outStatus The Status object.
+ * @return If the element is not freed, then the function returns the removed element. Otherwise, it returns the
+ * value NULL. In order to test the status of the operation, you must examine the Status object outStatus.
+ * @note The capacity of the Array object is not reduced. Call `CX_ArrayShrinkToFit()` to release unused memory.
+ * @note This function cannot be used with an inline Array object (use `CX_ArraySwapRemoveValue()` instead).
+ */
+
+void *CX_ArraySwapRemove(CX_Array inArray, size_t inIndex, bool inFree, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _storesPointers(inArray, "CX_ArraySwapRemoveValue", outStatus)) {
+        return NULL;
+    }
+    if (inIndex >= inArray->count) {
+        CX_StatusSetError(outStatus, 0, "The given index (%zu) exceeds the number of elements in the array (%zu).",
+                          inIndex, inArray->count);
+        return NULL;
+    }
+    if (inFree && NULL == inArray->elementDisposer) {
+        CX_StatusSetError(outStatus, 0,
+                          "The element should be freed, but no disposer function is specified for this array!");
+        return NULL;
+    }
+    if (! _unshare(inArray, outStatus)) {
+        return NULL;
+    }
+
+    void *element = inArray->elements[inIndex];
+    inArray->elements[inIndex] = inArray->elements[inArray->count - 1];
+    inArray->count -= 1;
+
+    if (inFree) {
+        inArray->elementDisposer(element);
+        element = NULL;
+    }
+    return element;
+}
+
+/**
+ * @brief Remove the value located at a given position within a given inline Array object, without preserving the
+ * order of the values: the last value is moved to the position of the removed one.
+ *
+ * Unlike `CX_ArrayRemoveValue()`, which shifts all the values that follow the removed one, this function costs O(1).
+ * @param inArray The inline Array object.
+ * @param inIndex The position of the value to remove.
+ * @param outValue Pointer to a memory location used to store a copy of the removed value.
+ * If this value is not NULL, then the removed value is copied to this location (and the caller becomes responsible for
+ * the resources it references). Otherwise, the removed value is disposed, using the function provided at the array
+ * creation (see function `CX_ArrayCreateInline()`), if any.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, the function returns the value false (which means that the given index is out of range).
+ * @note This function can only be used with an inline Array object (use `CX_ArraySwapRemove()` otherwise).
+ */
+
+bool CX_ArraySwapRemoveValue(CX_Array inArray, size_t inIndex, void *outValue, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _storesValues(inArray, "CX_ArraySwapRemove", outStatus)) {
+        return false;
+    }
+    if (inIndex >= inArray->count) {
+        CX_StatusSetError(outStatus, 0, "The given index (%zu) exceeds the number of elements in the array (%zu).",
+                          inIndex, inArray->count);
+        return false;
+    }
+    if (! _unshare(inArray, outStatus)) {
+        return false;
+    }
+
+    void *slot = CX_ARRAY_VALUE_AT(inArray, inIndex);
+    if (NULL != outValue) {
+        memcpy(outValue, slot, inArray->elementSize);
+    } else if (NULL != inArray->elementDisposer) {
+        inArray->elementDisposer(slot);
+    }
+    if (inIndex != inArray->count - 1) {
+        memcpy(slot, CX_ARRAY_VALUE_AT(inArray, inArray->count - 1), inArray->elementSize);
+    }
+    inArray->count -= 1;
+    return true;
+}
+
+/**
+ * @brief Remove all the elements of a given Array object that match a given predicate.
+ *
+ * The elements are examined in one pass: the elements that are kept are moved towards the beginning of the Array
+ * object (keeping their order), and each one is moved at most once. Thus, removing any number of elements costs O(N),
+ * whereas removing them one by one with `CX_ArrayRemove()` costs O(N^2).
+ * @param inArray The Array object. It may be an inline Array object (see `CX_ArrayCreateInline()`).
+ * @param inRemove A pointer to a function used to decide whether an element should be removed or not.
+ * The signature of this function is: `bool remove (void *element, void *context)`.
+ * `element`: this parameter will be assigned a pointer to an element of the array (for an inline Array object, a
+ * pointer to the value).
+ * `context`: this parameter will be assigned the value of the parameter `inContext`.
+ * If the element must be removed, then the function must return the value true.
+ * Otherwise, it returns the value false.
+ * @param inContext A pointer that is passed to the function `inRemove`.
+ * @param inFree This flag tells the function whether the removed elements should be freed or not.
+ * If the value of this parameter is true, then the removed elements will be freed, using the function provided at the
+ * array creation (see functions `CX_ArrayCreate()` and `CX_ArrayCreateInline()`).
+ * @param outStatus The Status object.
+ * @return The function returns the number of removed elements. In order to test the status of the operation, you
+ * must examine the Status object outStatus.
+ * @note The capacity of the Array object is not reduced. Call `CX_ArrayShrinkToFit()` to release unused memory.
+ */
+
+size_t CX_ArrayRemoveIf(CX_Array inArray, bool(*inRemove)(void*, void*), void *inContext, bool inFree,
+        CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (inFree && NULL == inArray->elementDisposer) {
+        CX_StatusSetError(outStatus, 0,
+                          "The elements should be freed, but no disposer function is specified for this array!");
+        return 0;
+    }
+    if (! _unshare(inArray, outStatus)) {
+        return 0;
+    }
+
+    size_t slotSize = CX_ARRAY_SLOT_SIZE(inArray);
+    char *elements = (char*)inArray->elements;
+    size_t kept = 0;
+    for (size_t i=0; i<inArray->count; i++) {
+        void *element = CX_ARRAY_ELEMENT_AT(inArray, i);
+        if (inRemove(element, inContext)) {
+            if (inFree) {
+                inArray->elementDisposer(element);
+            }
+            continue;
+        }
+        if (kept != i) {
+            memcpy(elements + slotSize * kept, elements + slotSize * i, slotSize);
+        }
+        kept++;
+    }
+    size_t removed = inArray->count - kept;
+    inArray->count = kept;
+    return removed;
+}
+
+/**
+ * @brief Search for elements within a given Array object.
+ * @param inArray The Array object.
+ * @param inKeep A pointer to a function used to decide whether an element should be kept or not.
+ * The signature of this function is: `bool elementCompare (void *element)`.
+ * `element`: this parameter will be assigned a pointer to an element of the array.
+ * If the element must be kept, then the function must return the value true.
+ * Otherwise, it returns the value false.
+ * @param outStatus The Status object.
+ * @return If elements are found, then the function returns a dynamic array that contains the elements.
+ * Otherwise, the function returns the value NULL.
+ * @warning The value NULL may be returned if the system ran out of memory. Thus, you should always examine the Status
+ * object outStatus.
+ * @warning Please keep in minf that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`.
+ * @note This function cannot be used with an inline Array object (use `CX_ArraySearchValues()` instead).
+ */
+CX_Array CX_ArraySearch(CX_Array inArray, bool(*inKeep)(void*), CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _storesPointers(inArray, "CX_ArraySearchValues", outStatus)) {
+        return NULL;
+    }
+    CX_ObjectManager m = CX_ObjectManagerCreate();
+    CX_Array found = CX_ArrayCreate(NULL, inArray->elementCloner);
+    if (NULL == found) {
+        CX_ObjectManagerDisposeOnError(m);
+        CX_StatusSetError(outStatus, 0, "Cannot allocate memory!");
+        return NULL;
+    }
+    CX_OBJECT_MANAGER_ADD_RESULT(m, found, CX_ArrayDispose);
+
+    bool foundElement = false;
+    for (size_t i=0; i<inArray->count; i++) {
+        if (inKeep(inArray->elements[i])) {
+            foundElement = true;
+            if (NULL == CX_ArrayAdd(found, inArray->elements[i])) {
+                CX_ObjectManagerDisposeOnError(m);
+                CX_StatusSetError(outStatus, 0, "Cannot allocate memory!");
+                return NULL;
+            }
+        }
+    }
+    if (! foundElement) {
+        CX_ObjectManagerDisposeAllOnSuccess(m);
+        return NULL;
+    }
+
+    CX_ObjectManagerDispose(m);
+    return found;
+}
+
+/**
+ * @brief Insert an element at a given position within a given Array object.
+ * @param inArray The Array object.
+ * @param inElement A pointer to the element to insert.
+ * Please note tat the inserted element is not cloned.
+ * @param inIndex The position within the Array object.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a pointer to the inserted element.
+ * Otherwise, the function returns the value NULL. This may mean that the system ran out of memory or that the given
+ * index is out of range.
+ * @note Please note that the first element of the Array object is located at the index 0.
+ * @note This function cannot be used with an inline Array object (use `CX_ArrayInsertValueAt()` instead).
+ */
+void *CX_ArrayInsertAt(CX_Array inArray, void *inElement, size_t inIndex, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _storesPointers(inArray, "CX_ArrayInsertValueAt", outStatus)) {
+        return NULL;
+    }
+
+    if (inIndex >= inArray->count) {
+        CX_StatusSetError(outStatus, 0, "Invalid index %zu. The array only contains %zu elements!", inIndex,
+                          inArray->count);
+        return NULL;
+    }
+
+    if (! _unshare(inArray, outStatus)) {
+        return NULL;
+    }
+    if (! _openGap(inArray, inIndex, 1)) {
+        CX_StatusSetError(outStatus, 0, "Cannot allocate memory!");
+        return NULL;
+    }
+    inArray->elements[inIndex] = inElement;
+
+    return inElement;
+}
+
+/**
+ * @brief Replace an element by another one in a given Array object, at a given position.
+ * @param inArray The Array object.
+ * @param inElement The replacement element.
+ * Please note tat the element that is replaced is not cloned.
+ * @param inIndex The position, within the Array object, of the element to replace.
+ * @param outStatus The Status object.
+ * @return Upon successful completion, the function returns the value true.
+ * Otherwise, the function returns the value false. In this case, you should examine the Status object:
+ * A failure can be the result of an invalid index or an insufficient memory.
+ * @note This function cannot be used with an inline Array object (use `CX_ArrayReplaceValueAt()` instead).
+ */
+
+bool CX_ArrayReplaceAt(CX_Array inArray, void *inElement, size_t inIndex, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _storesPointers(inArray, "CX_ArrayReplaceValueAt", outStatus)) {
+        return false;
+    }
+    if (inIndex >= inArray->count) {
+        CX_StatusSetError(outStatus, 0, "Invalid index %zu. The array only contains %zu elements!", inIndex,
+                          inArray->count);
+        return false;
+    }
+    if (! _unshare(inArray, outStatus)) {
+        return false;
+    }
+
+    if (NULL != inArray->elementDisposer) {
+        void *actualElement = CX_ArrayGetElementAt(inArray, inIndex);
+        inArray->elementDisposer(actualElement);
+    }
+    inArray->elements[inIndex] = inElement;
+    return true;
+}
+
+/**
+ * @brief Return the number of elements a given Array object can hold without reallocating memory.
+ * @param inArray The Array object.
+ * @return The function returns the capacity of the given Array object.
+ */
+
+size_t CX_ArrayGetCapacity(CX_Array inArray) {
+    return inArray->capacity;
+}
+
+/**
+ * @brief Make sure that a given Array object can hold a given number of elements without reallocating memory.
+ * @param inArray The Array object.
+ * @param inCapacity The number of elements the Array object must be able to hold.
+ * If the current capacity of the Array object is greater than, or equal to, this value, then the function does
+ * nothing.
+ * @param outStatus The Status object.
+ * @return Upon successful completion, the function returns the value true.
+ * Otherwise, the function returns the value false (which means that the process ran out of memory).
+ * @note Call this function before adding a known number of elements, in order to avoid intermediate reallocations.
+ */
+
+bool CX_ArrayReserve(CX_Array inArray, size_t inCapacity, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (inCapacity <= inArray->capacity) {
+        return true;
+    }
+    if (! _unshare(inArray, outStatus)) {
+        return false;
+    }
+    if (! _setCapacity(inArray, inCapacity)) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Release the memory allocated for a given Array object that is not used to hold elements.
+ * @param inArray The Array object.
+ * @param outStatus The Status object.
+ * @return Upon successful completion, the function returns the value true.
+ * Otherwise, the function returns the value false (which means that the process ran out of memory).
+ */
+
+bool CX_ArrayShrinkToFit(CX_Array inArray, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (inArray->count == inArray->capacity && 0 == inArray->front) {
+        return true;
+    }
+    if (! _unshare(inArray, outStatus)) {
+        return false;
+    }
+    if (inArray->front > 0) {
+        // Release the free slots that precede the first element.
+        size_t slotSize = CX_ARRAY_SLOT_SIZE(inArray);
+        char *buffer = (char*)_buffer(inArray);
+        memmove(buffer, inArray->elements, slotSize * inArray->count);
+        inArray->elements = (void**)buffer;
+        inArray->capacity += inArray->front;
+        inArray->front = 0;
+    }
+    if (! _setCapacity(inArray, inArray->count)) {
+        CX_StatusSetError(outStatus, errno, "Cannot reallocate memory!");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Create a new inline Array object: an Array object that stores its elements by value, in a contiguous buffer.
+ *
+ * Unlike an Array object created by `CX_ArrayCreate()`, which stores pointers to elements, an inline Array object
+ * stores copies of the elements themselves. Adding an element does not require the caller to allocate memory for it,
+ * and scanning the Array object reads contiguous memory.
+ * @param inElementSize The size, in bytes, of an element. This value must be greater than 0.
+ * @param elementDisposer Pointer to a function used to release the resources referenced by an element.
+ * The signature of this function is:  void elementDisposer (void *element)
+ *    Where:
+ *    - "element" is a pointer to the value stored within the Array object. The function must **not** free this pointer.
+ * If the elements don't reference any resource, then you should pass the value NULL for this parameter.
+ * @return Upon successful completion the function returns a new inline Array object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory, or that the given
+ * element size is 0).
+ * @warning Please keep in mind that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`.
+ * @note Use the functions `CX_ArrayAddValue()`, `CX_ArrayGetValueAt()`, `CX_ArrayInsertValueAt()`,
+ * `CX_ArrayRemoveValue()`, `CX_ArrayReplaceValueAt()` and `CX_ArraySearchValues()` to manipulate inline Array objects.
+ */
+
+CX_Array CX_ArrayCreateInline(size_t inElementSize, void(*elementDisposer)(void*)) {
+    if (0 == inElementSize) {
+        return NULL;
+    }
+    CX_Array array = CX_ArrayCreate(elementDisposer, NULL);
+    if (NULL == array) {
+        return NULL;
+    }
+    array->elementSize = inElementSize;
+    return array;
+}
+
+/**
+ * @brief Return the size of the elements stored by value within a given Array object.
+ * @param inArray The Array object.
+ * @return If the Array object is an inline Array object, then the function returns the size, in bytes, of one element.
+ * Otherwise, the function returns the value 0.
+ */
+
+size_t CX_ArrayGetElementSize(CX_Array inArray) {
+    return inArray->elementSize;
+}
+
+/**
+ * @brief Returns the buffer that contains the values of a given inline Array object.
+ * @param inArray The inline Array object.
+ * @return The function returns a pointer to the first value. The values are contiguous.
+ * For example, for an inline Array object of `int`, the returned pointer can be cast into `int*`.
+ * @warning The returned pointer becomes invalid as soon as an element is added to the Array object.
+ */
+
+void *CX_ArrayGetValues(CX_Array inArray) {
+    return (void*)inArray->elements;
+}
+
+/**
+ * @brief Returns a pointer to the value positioned at a given position within a given inline Array object.
+ * @param inArray The inline Array object.
+ * @param inIndex The position within the Array object.
+ * @return Upon successful completion the function returns a pointer to the value stored within the Array object.
+ * Otherwise, the function returns the value NULL. This means that the given index is not valid (greater or equal to the
+ * total number of elements in the Array object), or that the Array object is not an inline Array object (use
+ * `CX_ArrayGetElementAt()` instead).
+ * @warning The returned pointer becomes invalid as soon as an element is added to the Array object.
+ * @note Please note that the first element of the Array object is located at the index 0.
+ */
+
+void *CX_ArrayGetValueAt(CX_Array inArray, size_t inIndex) {
+    if (! _storesValues(inArray, "CX_ArrayGetElementAt", NULL) || inIndex >= inArray->count) {
+        return NULL;
+    }
+    return CX_ARRAY_VALUE_AT(inArray, inIndex);
+}
+
+/**
+ * @brief Add a copy of a value at the end of a given inline Array object.
+ * @param inArray The inline Array object.
+ * @param inValue A pointer to the value to add. The `elementSize` bytes pointed by this parameter are copied.
+ * @return Upon successful completion the function returns a pointer to the copy of the value stored within the Array
+ * object. Otherwise, the function returns the value NULL. This means that the system could not allocate memory, or that
+ * the Array object is not an inline Array object (use `CX_ArrayAdd()` instead).
+ */
+
+void *CX_ArrayAddValue(CX_Array inArray, const void *inValue) {
+    if (! _storesValues(inArray, "CX_ArrayAdd", NULL) || ! _unshare(inArray, NULL) ||
+        ! _grow(inArray, inArray->count + 1)) {
+        return NULL;
+    }
+    void *slot = CX_ARRAY_VALUE_AT(inArray, inArray->count);
+    memcpy(slot, inValue, inArray->elementSize);
+    inArray->count += 1;
+    return slot;
+}
+
+/**
+ * @brief Insert a copy of a value at a given position within a given inline Array object.
+ * @param inArray The inline Array object.
+ * @param inValue A pointer to the value to insert. The `elementSize` bytes pointed by this parameter are copied.
+ * @param inIndex The position within the Array object.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a pointer to the copy of the value stored within the Array
+ * object. Otherwise, the function returns the value NULL. This may mean that the system ran out of memory or that the
+ * given index is out of range.
+ * @note Please note that the first element of the Array object is located at the index 0.
+ * @note This function can only be used with an inline Array object (use `CX_ArrayInsertAt()` otherwise).
+ */
+
+void *CX_ArrayInsertValueAt(CX_Array inArray, const void *inValue, size_t inIndex, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _storesValues(inArray, "CX_ArrayInsertAt", outStatus)) {
+        return NULL;
+    }
+
+    if (inIndex >= inArray->count) {
+        CX_StatusSetError(outStatus, 0, "Invalid index %zu. The array only contains %zu elements!", inIndex,
+                          inArray->count);
+        return NULL;
+    }
+
+    if (! _unshare(inArray, outStatus)) {
+        return NULL;
+    }
+    if (! _openGap(inArray, inIndex, 1)) {
+        CX_StatusSetError(outStatus, 0, "Cannot allocate memory!");
+        return NULL;
+    }
+
+    void *slot = CX_ARRAY_VALUE_AT(inArray, inIndex);
+    memcpy(slot, inValue, inArray->elementSize);
+    return slot;
+}
+
+/**
+ * @brief Remove the value located at a given position within a given inline Array object.
+ * @param inArray The inline Array object.
+ * @param inIndex The position of the value to remove.
+ * @param outValue Pointer to a memory location used to store a copy of the removed value.
+ * If this value is not NULL, then the removed value is copied to this location (and the caller becomes responsible for
+ * the resources it references). Otherwise, the removed value is disposed, using the function provided at the array
+ * creation (see function `CX_ArrayCreateInline()`), if any.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, the function returns the value false (which means that the given index is out of range).
+ * @note Please note that the first element of the Array object is located at the index 0.
+ * @note This function can only be used with an inline Array object (use `CX_ArrayRemove()` otherwise).
+ */
+
+bool CX_ArrayRemoveValue(CX_Array inArray, size_t inIndex, void *outValue, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _storesValues(inArray, "CX_ArrayRemove", outStatus)) {
+        return false;
+    }
+    if (inIndex >= inArray->count) {
+        CX_StatusSetError(outStatus, 0, "The given index (%zu) exceeds the number of elements in the array (%zu).",
+                          inIndex, inArray->count);
+        return false;
+    }
+    if (! _unshare(inArray, outStatus)) {
+        return false;
+    }
+
+    void *slot = CX_ARRAY_VALUE_AT(inArray, inIndex);
+    if (NULL != outValue) {
+        memcpy(outValue, slot, inArray->elementSize);
+    } else if (NULL != inArray->elementDisposer) {
+        inArray->elementDisposer(slot);
+    }
+    _closeGap(inArray, inIndex, 1);
+    return true;
+}
+
+/**
+ * @brief Replace the value at a given position within a given inline Array object by a copy of a given value.
+ * @param inArray The inline Array object.
+ * @param inValue A pointer to the replacement value. The `elementSize` bytes pointed by this parameter are copied.
+ * The value that is replaced is disposed, using the function provided at the array creation, if any.
+ * @param inIndex The position, within the Array object, of the value to replace.
+ * @param outStatus The Status object.
+ * @return Upon successful completion, the function returns the value true.
+ * Otherwise, the function returns the value false (which means that the given index is out of range).
+ * @note This function can only be used with an inline Array object (use `CX_ArrayReplaceAt()` otherwise).
+ */
+
+bool CX_ArrayReplaceValueAt(CX_Array inArray, const void *inValue, size_t inIndex, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _storesValues(inArray, "CX_ArrayReplaceAt", outStatus)) {
+        return false;
+    }
+    if (inIndex >= inArray->count) {
+        CX_StatusSetError(outStatus, 0, "Invalid index %zu. The array only contains %zu elements!", inIndex,
+                          inArray->count);
+        return false;
+    }
+    if (! _unshare(inArray, outStatus)) {
+        return false;
+    }
+
+    void *slot = CX_ARRAY_VALUE_AT(inArray, inIndex);
+    if (NULL != inArray->elementDisposer) {
+        inArray->elementDisposer(slot);
+    }
+    memcpy(slot, inValue, inArray->elementSize);
+    return true;
+}
+
+/**
+ * @brief Search for values within a given inline Array object.
+ * @param inArray The inline Array object.
+ * @param inKeep A pointer to a function used to decide whether a value should be kept or not.
+ * The signature of this function is: `bool elementCompare (void *element)`.
+ * `element`: this parameter will be assigned a pointer to a value stored within the array.
+ * If the value must be kept, then the function must return the value true.
+ * Otherwise, it returns the value false.
+ * @param outStatus The Status object.
+ * @return If values are found, then the function returns an inline Array object that contains copies of the values.
+ * Otherwise, the function returns the value NULL.
+ * @warning The value NULL may be returned if the system ran out of memory. Thus, you should always examine the Status
+ * object outStatus.
+ * @warning Please keep in mind that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`. The returned Array object has no disposer: the resources
+ * referenced by the copied values still belong to the given Array object.
+ * @note This function can only be used with an inline Array object (use `CX_ArraySearch()` otherwise).
+ */
+
+CX_Array CX_ArraySearchValues(CX_Array inArray, bool(*inKeep)(void*), CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _storesValues(inArray, "CX_ArraySearch", outStatus)) {
+        return NULL;
+    }
+    CX_Array found = NULL;
+
+    for (size_t i=0; i<inArray->count; i++) {
+        void *slot = CX_ARRAY_VALUE_AT(inArray, i);
+        if (! inKeep(slot)) {
+            continue;
+        }
+        if (NULL == found) {
+            found = CX_ArrayCreateInline(inArray->elementSize, NULL);
+            if (NULL == found) {
+                CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+                return NULL;
+            }
+        }
+        if (NULL == CX_ArrayAddValue(found, slot)) {
+            CX_ArrayDispose(found);
+            CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+            return NULL;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Add a list of elements at the end of a given Array object.
+ *
+ * The buffer of the Array object is enlarged (at most) once, and the elements are copied in one operation.
+ * @param inArray The Array object.
+ * @param inElements A pointer to the first of the elements to add.
+ * - If the Array object stores pointers (see `CX_ArrayCreate()`), then this parameter points to an array of `inCount`
+ *   pointers (`void*`). Please note that the pointed elements are not cloned!
+ * - If the Array object is an inline Array object (see `CX_ArrayCreateInline()`), then this parameter points to
+ *   `inCount` contiguous values, which are copied.
+ * @param inCount The number of elements to add.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory, or that the Array object
+ * would contain too many elements). In this case, the Array object is left untouched.
+ */
+
+bool CX_ArrayAddMany(CX_Array inArray, const void *inElements, size_t inCount, CX_Status outStatus) {
+    return CX_ArrayInsertRange(inArray, inElements, inCount, inArray->count, outStatus);
+}
+
+/**
+ * @brief Insert a list of elements at a given position within a given Array object.
+ *
+ * The buffer of the Array object is enlarged (at most) once, and the elements that follow the insertion point are
+ * moved in one operation.
+ * @param inArray The Array object.
+ * @param inElements A pointer to the first of the elements to insert (see `CX_ArrayAddMany()`).
+ * @param inCount The number of elements to insert.
+ * @param inIndex The position, within the Array object, of the first inserted element.
+ * Unlike `CX_ArrayInsertAt()`, this value may be equal to the number of elements in the Array object. In this case, the
+ * elements are added at the end of the Array object.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false. This may mean that the system ran out of memory or that the given index is
+ * out of range. In this case, the Array object is left untouched.
+ * @note Please note that the first element of the Array object is located at the index 0.
+ */
+
+bool CX_ArrayInsertRange(CX_Array inArray, const void *inElements, size_t inCount, size_t inIndex,
+        CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+
+    if (inIndex > inArray->count) {
+        CX_StatusSetError(outStatus, 0, "Invalid index %zu. The array only contains %zu elements!", inIndex,
+                          inArray->count);
+        return false;
+    }
+    if (0 == inCount) {
+        return true;
+    }
+    if (inCount > SIZE_MAX - inArray->count) {
+        CX_StatusSetError(outStatus, 0, "Cannot add %zu elements to an array that contains %zu elements!", inCount,
+                          inArray->count);
+        return false;
+    }
+    if (! _unshare(inArray, outStatus)) {
+        return false;
+    }
+    if (! _openGap(inArray, inIndex, inCount)) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return false;
+    }
+
+    size_t slotSize = CX_ARRAY_SLOT_SIZE(inArray);
+    memcpy((char*)inArray->elements + slotSize * inIndex, inElements, slotSize * inCount);
+    return true;
+}
+
+/**
+ * @brief Remove a list of consecutive elements from a given Array object.
+ *
+ * The elements that follow the removed ones are moved in one operation.
+ * @param inArray The Array object.
+ * @param inIndex The position of the first element to remove.
+ * @param inCount The number of elements to remove.
+ * @param inFree This flag tells the function whether the removed elements should be freed or not.
+ * If the value of this parameter is true, then the removed elements will be freed, using the function provided at the
+ * array creation (see functions `CX_ArrayCreate()` and `CX_ArrayCreateInline()`).
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the given range exceeds the number of elements in the
+ * Array object, or that the elements should be freed while no disposer is specified for the Array object).
+ * In this case, the Array object is left untouched.
+ * @note The capacity of the Array object is not reduced. Call `CX_ArrayShrinkToFit()` to release unused memory.
+ */
+
+bool CX_ArrayRemoveRange(CX_Array inArray, size_t inIndex, size_t inCount, bool inFree,
+        CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+
+    if (inIndex > inArray->count || inCount > inArray->count - inIndex) {
+        CX_StatusSetError(outStatus, 0, "The given range [%zu, %zu[ exceeds the number of elements in the array (%zu).",
+                          inIndex, inIndex + inCount, inArray->count);
+        return false;
+    }
+    if (0 == inCount) {
+        return true;
+    }
+    if (inFree && NULL == inArray->elementDisposer) {
+        CX_StatusSetError(outStatus, 0,
+                          "The elements should be freed, but no disposer function is specified for this array!");
+        return false;
+    }
+    if (! _unshare(inArray, outStatus)) {
+        return false;
+    }
+
+    if (inFree) {
+        for (size_t i=inIndex; i<inIndex+inCount; i++) {
+            inArray->elementDisposer(CX_ARRAY_ELEMENT_AT(inArray, i));
+        }
+    }
+
+    _closeGap(inArray, inIndex, inCount);
+    return true;
+}
+
+/**
+ * @brief Keep only the first elements of a given Array object.
+ *
+ * Unlike `CX_ArrayRemoveRange()`, this function does not dispose the removed elements: they now belong to the caller.
+ * If the Array object shares its elements with other Array objects (see `CX_ArraySetCopyOnWrite()`), then it gets its
+ * own copy of the elements first, so that the removed elements are not referenced by the other Array objects.
+ * @param inArray The Array object. It must not be an arena Array object (see `CX_ArrayCreateArena()`), an Array
+ * object loaded from an image (see `CX_ArrayLoadInlineMapped()`) or a concurrent Array object that has not been sealed
+ * (see `CX_ArrayCreateConcurrent()`): their elements never belong to the caller.
+ * @param inCount The number of elements to keep. If the Array object does not contain more elements, then it is left
+ * untouched.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, the function returns the value false (which means that the Array object cannot give its elements away, or
+ * that the process ran out of memory). In this case, the Array object is left untouched.
+ * @note The capacity of the Array object is not reduced. Call `CX_ArrayShrinkToFit()` to release unused memory.
+ */
+
+bool CX_ArrayTruncate(CX_Array inArray, size_t inCount) {
+    if (inCount >= inArray->count) {
+        return true;
+    }
+    if (CX_ARRAY_IS_ARENA(inArray) || NULL != inArray->image || NULL != inArray->concurrent ||
+        ! _unshare(inArray, NULL)) {
+        return false;
+    }
+    inArray->count = inCount;
+    return true;
+}
+
+/**
+ * @brief The description of a search executed by `CX_ArraySearchEx()`.
+ */
+
+struct _CX_ArraySearchJob {
+    CX_Array array;
+    bool(*keep)(void*, void*);
+    void *context;
+    /**
+     * One Array object per task, used to store the elements kept by the task.
+     */
+    CX_Array *found;
+    /**
+     * One flag per task. The value true means that the task ran out of memory.
+     */
+    bool *failed;
+};
+
+/**
+ * @brief Search for elements within a range of an Array object.
+ * @param inTaskIndex The index of the task.
+ * @param inTaskCount The total number of tasks.
+ * @param inJob The description of the search (a pointer to a `struct _CX_ArraySearchJob`).
+ * @note This function is used by the function `CX_ArraySearchEx()`.
+ */
+
+static void _searchTask(unsigned int inTaskIndex, unsigned int inTaskCount, void *inJob) {
+    struct _CX_ArraySearchJob *job = (struct _CX_ArraySearchJob*)inJob;
+    CX_Array array = job->array;
+    CX_Array found = job->found[inTaskIndex];
+    size_t begin, end;
+
+    CX_ParallelGetRange(array->count, inTaskIndex, inTaskCount, &begin, &end);
+    for (size_t i=begin; i<end; i++) {
+        void *element = CX_ARRAY_ELEMENT_AT(array, i);
+        if (! job->keep(element, job->context)) {
+            continue;
+        }
+        void *added = 0 == array->elementSize ? CX_ArrayAdd(found, element) : CX_ArrayAddValue(found, element);
+        if (NULL == added) {
+            job->failed[inTaskIndex] = true;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Search for elements within a given Array object, using several threads.
+ *
+ * The Array object is split into contiguous ranges. Each range is searched by a thread. Then the results are merged
+ * so that the found elements keep the order they have within the given Array object.
+ * @param inArray The Array object. It may be an inline Array object (see `CX_ArrayCreateInline()`).
+ * @param inKeep A pointer to a function used to decide whether an element should be kept or not.
+ * The signature of this function is: `bool elementCompare (void *element, void *context)`.
+ * `element`: this parameter will be assigned a pointer to an element of the array.
+ * `context`: this parameter will be assigned the value of the parameter `inContext`.
+ * If the element must be kept, then the function must return the value true.
+ * Otherwise, it returns the value false.
+ * @param inContext A pointer that is passed to the function `inKeep`.
+ * @param inThreads The maximum number of threads to use. The value 0 means "as many threads as online processors".
+ * Small arrays are searched by less threads (possibly only the calling thread).
+ * @param outStatus The Status object.
+ * @return If elements are found, then the function returns a dynamic array that contains the elements (or, for an
+ * inline Array object, copies of the values).
+ * Otherwise, the function returns the value NULL.
+ * @warning The function `inKeep` is called concurrently from several threads. It must be thread safe.
+ * @warning The value NULL may be returned if the system ran out of memory. Thus, you should always examine the Status
+ * object outStatus.
+ * @warning Please keep in mind that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`.
+ */
+
+CX_Array CX_ArraySearchEx(CX_Array inArray, bool(*inKeep)(void*, void*), void *inContext, unsigned int inThreads,
+        CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    CX_ObjectManager m = CX_ObjectManagerCreate();
+    unsigned int threads = CX_ParallelGetThreadCount(inThreads, inArray->count, CX_ARRAY_PARALLEL_GRAIN);
+
+    struct _CX_ArraySearchJob job;
+    job.array = inArray;
+    job.keep = inKeep;
+    job.context = inContext;
+    job.found = (CX_Array*)calloc(threads, sizeof(CX_Array));
+    CX_OBJECT_MANAGER_ADD(m, job.found, free);
+    job.failed = (bool*)calloc(threads, sizeof(bool));
+    CX_OBJECT_MANAGER_ADD(m, job.failed, free);
+    if (NULL == job.found || NULL == job.failed) {
+        CX_ObjectManagerDisposeOnError(m);
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+
+    for (unsigned int i=0; i<threads; i++) {
+        job.found[i] = 0 == inArray->elementSize ?
+                CX_ArrayCreate(NULL, inArray->elementCloner) : CX_ArrayCreateInline(inArray->elementSize, NULL);
+        if (NULL == job.found[i]) {
+            CX_ObjectManagerDisposeOnError(m);
+            CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+            return NULL;
+        }
+        // The first Array object is the result. The others are merged into it.
+        if (0 == i) {
+            CX_OBJECT_MANAGER_ADD_RESULT(m, job.found[i], CX_ArrayDispose);
+        } else {
+            CX_OBJECT_MANAGER_ADD(m, job.found[i], CX_ArrayDispose);
+        }
+    }
+
+    CX_ParallelRun(threads, &_searchTask, &job);
+
+    size_t total = 0;
+    for (unsigned int i=0; i<threads; i++) {
+        if (job.failed[i]) {
+            CX_ObjectManagerDisposeOnError(m);
+            CX_StatusSetError(outStatus, 0, "Cannot allocate memory!");
+            return NULL;
+        }
+        total += job.found[i]->count;
+    }
+    if (0 == total) {
+        CX_ObjectManagerDisposeAllOnSuccess(m);
+        return NULL;
+    }
+
+    CX_Array found = job.found[0];
+    if (! _grow(found, total)) {
+        CX_ObjectManagerDisposeOnError(m);
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    for (unsigned int i=1; i<threads; i++) {
+        // The capacity has been reserved: this cannot fail.
+        CX_ArrayAddMany(found, job.found[i]->elements, job.found[i]->count, outStatus);
+    }
+
+    CX_ObjectManagerDispose(m);
+    return found;
+}
+
+/*! \brief Below this number of elements, the introsort uses an insertion sort.
+ */
+
+#define CX_ARRAY_SORT_INSERTION_THRESHOLD 16
+
+/*! \brief Size of the buffer used to swap two values of an inline Array object.
+ */
+
+#define CX_ARRAY_SORT_SWAP_BUFFER_SIZE 64
+
+/**
+ * @brief The description of a sort (or of a binary search) over the slots of an Array object.
+ */
+
+struct _CX_ArraySorter {
+    size_t slotSize;
+    /**
+     * The value true means that the slots hold values (inline Array object).
+     * The value false means that the slots hold pointers to elements.
+     */
+    bool byValue;
+    int(*compare)(void*, void*, void*);
+    void *context;
+};
+
+/**
+ * @brief Initialise a sorter for a given Array object.
+ * @param outSorter The sorter to initialise.
+ * @param inArray The Array object.
+ * @param inCompare The comparison function.
+ * @param inContext The context passed to the comparison function.
+ */
+
+static void _sorterInit(struct _CX_ArraySorter *outSorter, CX_Array inArray, int(*inCompare)(void*, void*, void*),
+        void *inContext) {
+    outSorter->slotSize = CX_ARRAY_SLOT_SIZE(inArray);
+    outSorter->byValue = 0 != inArray->elementSize;
+    outSorter->compare = inCompare;
+    outSorter->context = inContext;
+}
+
+/**
+ * @brief Compare the elements held by two slots.
+ * @param inSorter The sorter.
+ * @param inA The first slot.
+ * @param inB The second slot.
+ * @return The function returns the value returned by the comparison function.
+ */
+
+static int _sorterCompare(struct _CX_ArraySorter *inSorter, char *inA, char *inB) {
+    if (inSorter->byValue) {
+        return inSorter->compare(inA, inB, inSorter->context);
+    }
+    return inSorter->compare(*(void**)inA, *(void**)inB, inSorter->context);
+}
+
+/**
+ * @brief Swap the contents of two slots.
+ * @param inSorter The sorter.
+ * @param inA The first slot.
+ * @param inB The second slot.
+ */
+
+static void _sorterSwap(struct _CX_ArraySorter *inSorter, char *inA, char *inB) {
+    if (! inSorter->byValue) {
+        void *tmp = *(void**)inA;
+        *(void**)inA = *(void**)inB;
+        *(void**)inB = tmp;
+        return;
+    }
+    // Fixed size copies are compiled into plain moves.
+    if (4 == inSorter->slotSize) {
+        char tmp[4];
+        memcpy(tmp, inA, 4);
+        memcpy(inA, inB, 4);
+        memcpy(inB, tmp, 4);
+        return;
+    }
+    if (8 == inSorter->slotSize) {
+        char tmp[8];
+        memcpy(tmp, inA, 8);
+        memcpy(inA, inB, 8);
+        memcpy(inB, tmp, 8);
+        return;
+    }
+    char buffer[CX_ARRAY_SORT_SWAP_BUFFER_SIZE];
+    for (size_t done = 0; done < inSorter->slotSize; done += CX_ARRAY_SORT_SWAP_BUFFER_SIZE) {
+        size_t length = inSorter->slotSize - done;
+        if (length > CX_ARRAY_SORT_SWAP_BUFFER_SIZE) {
+            length = CX_ARRAY_SORT_SWAP_BUFFER_SIZE;
+        }
+        memcpy(buffer, inA + done, length);
+        memcpy(inA + done, inB + done, length);
+        memcpy(inB + done, buffer, length);
+    }
+}
+
+/**
+ * @brief Restore the heap property for the sub-tree rooted at a given node (see `_heapSort()`).
+ * @param inSorter The sorter.
+ * @param inBase The first slot of the heap.
+ * @param inRoot The index of the root of the sub-tree.
+ * @param inCount The number of slots in the heap.
+ */
+
+static void _siftDown(struct _CX_ArraySorter *inSorter, char *inBase, size_t inRoot, size_t inCount) {
+    size_t size = inSorter->slotSize;
+    while (true) {
+        size_t child = 2 * inRoot + 1;
+        if (child >= inCount) {
+            return;
+        }
+        if (child + 1 < inCount && _sorterCompare(inSorter, inBase + child * size, inBase + (child + 1) * size) < 0) {
+            child++;
+        }
+        if (_sorterCompare(inSorter, inBase + inRoot * size, inBase + child * size) >= 0) {
+            return;
+        }
+        _sorterSwap(inSorter, inBase + inRoot * size, inBase + child * size);
+        inRoot = child;
+    }
+}
+
+/**
+ * @brief Sort a range of slots using the heap sort algorithm.
+ * @param inSorter The sorter.
+ * @param inBase The first slot.
+ * @param inCount The number of slots.
+ */
+
+static void _heapSort(struct _CX_ArraySorter *inSorter, char *inBase, size_t inCount) {
+    for (size_t i = inCount / 2; i > 0; i--) {
+        _siftDown(inSorter, inBase, i - 1, inCount);
+    }
+    for (size_t end = inCount; end > 1; end--) {
+        _sorterSwap(inSorter, inBase, inBase + (end - 1) * inSorter->slotSize);
+        _siftDown(inSorter, inBase, 0, end - 1);
+    }
+}
+
+/**
+ * @brief Sort a range of slots using the insertion sort algorithm.
+ * @param inSorter The sorter.
+ * @param inBase The first slot.
+ * @param inCount The number of slots.
+ */
+
+static void _insertionSort(struct _CX_ArraySorter *inSorter, char *inBase, size_t inCount) {
+    size_t size = inSorter->slotSize;
+    for (size_t i = 1; i < inCount; i++) {
+        for (size_t j = i; j > 0 && _sorterCompare(inSorter, inBase + (j - 1) * size, inBase + j * size) > 0; j--) {
+            _sorterSwap(inSorter, inBase + (j - 1) * size, inBase + j * size);
+        }
+    }
+}
+
+/**
+ * @brief Sort a range of slots using the introsort algorithm.
+ *
+ * The range is sorted with a quick sort (median of three pivot). If the recursion becomes too deep (which denotes a
+ * pathological input), then the heap sort is used. Small ranges are sorted with an insertion sort.
+ * @param inSorter The sorter.
+ * @param inBase The first slot.
+ * @param inCount The number of slots.
+ * @param inDepth The number of partitioning steps allowed before switching to the heap sort.
+ */
+
+static void _introSort(struct _CX_ArraySorter *inSorter, char *inBase, size_t inCount, unsigned int inDepth) {
+    size_t size = inSorter->slotSize;
+
+    while (inCount > CX_ARRAY_SORT_INSERTION_THRESHOLD) {
+        if (0 == inDepth) {
+            _heapSort(inSorter, inBase, inCount);
+            return;
+        }
+        inDepth--;
+
+        // Move the median of the first, middle and last slots to the first slot: it is the pivot.
+        char *first = inBase;
+        char *middle = inBase + (inCount / 2) * size;
+        char *last = inBase + (inCount - 1) * size;
+        if (_sorterCompare(inSorter, middle, first) < 0) _sorterSwap(inSorter, middle, first);
+        if (_sorterCompare(inSorter, last, middle) < 0) {
+            _sorterSwap(inSorter, last, middle);
+            if (_sorterCompare(inSorter, middle, first) < 0) _sorterSwap(inSorter, middle, first);
+        }
+        _sorterSwap(inSorter, first, middle);
+
+        size_t i = 1;
+        size_t j = inCount - 1;
+        while (true) {
+            while (i <= j && _sorterCompare(inSorter, inBase + i * size, first) < 0) i++;
+            while (j >= i && _sorterCompare(inSorter, inBase + j * size, first) > 0) j--;
+            if (i >= j) {
+                break;
+            }
+            _sorterSwap(inSorter, inBase + i * size, inBase + j * size);
+            i++;
+            j--;
+        }
+        _sorterSwap(inSorter, first, inBase + j * size);
+
+        // Recurse into the smallest part, and loop over the largest one.
+        size_t leftCount = j;
+        size_t rightCount = inCount - j - 1;
+        if (leftCount < rightCount) {
+            _introSort(inSorter, inBase, leftCount, inDepth);
+            inBase += (j + 1) * size;
+            inCount = rightCount;
+        } else {
+            _introSort(inSorter, inBase + (j + 1) * size, rightCount, inDepth);
+            inCount = leftCount;
+        }
+    }
+    _insertionSort(inSorter, inBase, inCount);
+}
+
+/**
+ * @brief Sort a range of slots.
+ * @param inSorter The sorter.
+ * @param inBase The first slot.
+ * @param inCount The number of slots.
+ */
+
+static void _sort(struct _CX_ArraySorter *inSorter, char *inBase, size_t inCount) {
+    unsigned int depth = 0;
+    for (size_t n = inCount; n > 1; n >>= 1) {
+        depth += 2;
+    }
+    _introSort(inSorter, inBase, inCount, depth);
+}
+
+/**
+ * @brief Sort the elements of a given Array object.
+ *
+ * The function uses an introsort: O(n log n) in the worst case. It does not allocate memory.
+ * @param inArray The Array object. It may be an inline Array object (see `CX_ArrayCreateInline()`).
+ * @param inCompare A pointer to a function used to compare two elements.
+ * The signature of this function is: `int compare (void *a, void *b, void *context)`.
+ * `a` and `b`: these parameters will be assigned pointers to elements of the array (or, for an inline Array object,
+ * pointers to values stored within the array).
+ * `context`: this parameter will be assigned the value of the parameter `inContext`.
+ * The function must return a negative value if `a` is lower than `b`, 0 if `a` is equal to `b`, or a positive value
+ * if `a` is greater than `b`.
+ * @param inContext A pointer that is passed to the function `inCompare`.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false. This can only happen if the Array object shares its elements with other Array
+ * objects (see `CX_ArraySetCopyOnWrite()`), and if the elements could not be copied.
+ * @note The sort is not stable: the order of equal elements is not preserved.
+ */
+
+bool CX_ArraySort(CX_Array inArray, int(*inCompare)(void*, void*, void*), void *inContext) {
+    if (! _unshare(inArray, NULL)) {
+        return false;
+    }
+    struct _CX_ArraySorter sorter;
+    _sorterInit(&sorter, inArray, inCompare, inContext);
+    _sort(&sorter, (char*)inArray->elements, inArray->count);
+    return true;
+}
+
+/**
+ * @brief The description of a parallel merge sort executed by `CX_ArraySortParallel()`.
+ */
+
+struct _CX_ArraySortJob {
+    struct _CX_ArraySorter sorter;
+    /**
+     * The first slot of the buffer being sorted.
+     */
+    char *base;
+    size_t count;
+    /**
+     * The two sorted runs to merge: [source + beginA, source + endA[ and [source + endA, source + endB[.
+     */
+    char *source;
+    char *destination;
+    size_t beginA;
+    size_t endA;
+    size_t endB;
+};
+
+/**
+ * @brief Sort one of the ranges of a buffer.
+ * @param inTaskIndex The index of the task.
+ * @param inTaskCount The total number of tasks.
+ * @param inJob The description of the sort (a pointer to a `struct _CX_ArraySortJob`).
+ * @note This function is used by the function `CX_ArraySortParallel()`.
+ */
+
+static void _sortTask(unsigned int inTaskIndex, unsigned int inTaskCount, void *inJob) {
+    struct _CX_ArraySortJob *job = (struct _CX_ArraySortJob*)inJob;
+    size_t begin, end;
+    CX_ParallelGetRange(job->count, inTaskIndex, inTaskCount, &begin, &end);
+    _sort(&job->sorter, job->base + begin * job->sorter.slotSize, end - begin);
+}
+
+/**
+ * @brief Return the number of elements taken from the first run among the first `inRank` elements of the (stable)
+ * merge of two sorted runs.
+ * @param inSorter The sorter.
+ * @param inRank The number of merged elements.
+ * @param inA The first run.
+ * @param inCountA The number of elements in the first run.
+ * @param inB The second run.
+ * @param inCountB The number of elements in the second run.
+ * @return The function returns the number of elements taken from the first run.
+ */
+
+static size_t _coRank(struct _CX_ArraySorter *inSorter, size_t inRank, char *inA, size_t inCountA, char *inB,
+        size_t inCountB) {
+    size_t size = inSorter->slotSize;
+    size_t low = inRank > inCountB ? inRank - inCountB : 0;
+    size_t high = inRank < inCountA ? inRank : inCountA;
+    while (true) {
+        size_t i = low + (high - low) / 2;
+        size_t j = inRank - i;
+        if (i < inCountA && j > 0 && _sorterCompare(inSorter, inB + (j - 1) * size, inA + i * size) >= 0) {
+            low = i + 1;
+        } else if (i > 0 && j < inCountB && _sorterCompare(inSorter, inA + (i - 1) * size, inB + j * size) > 0) {
+            high = i - 1;
+        } else {
+            return i;
+        }
+    }
+}
+
+/**
+ * @brief Merge a part of two sorted runs.
+ *
+ * The output of the merge is split into as many ranges as tasks. Each task computes its own range.
+ * @param inTaskIndex The index of the task.
+ * @param inTaskCount The total number of tasks.
+ * @param inJob The description of the sort (a pointer to a `struct _CX_ArraySortJob`).
+ * @note This function is used by the function `CX_ArraySortParallel()`.
+ */
+
+static void _mergeTask(unsigned int inTaskIndex, unsigned int inTaskCount, void *inJob) {
+    struct _CX_ArraySortJob *job = (struct _CX_ArraySortJob*)inJob;
+    struct _CX_ArraySorter *sorter = &job->sorter;
+    size_t size = sorter->slotSize;
+    char *a = job->source + job->beginA * size;
+    char *b = job->source + job->endA * size;
+    size_t countA = job->endA - job->beginA;
+    size_t countB = job->endB - job->endA;
+    size_t begin, end;
+
+    CX_ParallelGetRange(countA + countB, inTaskIndex, inTaskCount, &begin, &end);
+    size_t i = _coRank(sorter, begin, a, countA, b, countB);
+    size_t j = begin - i;
+    size_t iEnd = _coRank(sorter, end, a, countA, b, countB);
+    size_t jEnd = end - iEnd;
+
+    char *out = job->destination + (job->beginA + begin) * size;
+    while (i < iEnd && j < jEnd) {
+        if (_sorterCompare(sorter, b + j * size, a + i * size) < 0) {
+            memcpy(out, b + j * size, size);
+            j++;
+        } else {
+            memcpy(out, a + i * size, size);
+            i++;
+        }
+        out += size;
+    }
+    memcpy(out, a + i * size, (iEnd - i) * size);
+    out += (iEnd - i) * size;
+    memcpy(out, b + j * size, (jEnd - j) * size);
+}
+
+/**
+ * @brief Sort the elements of a given Array object, using several threads.
+ *
+ * The Array object is split into contiguous ranges which are sorted concurrently (see `CX_ArraySort()`). Then, the
+ * sorted ranges are merged, pair by pair. Each merge is itself split between the threads.
+ * @param inArray The Array object. It may be an inline Array object (see `CX_ArrayCreateInline()`).
+ * @param inCompare A pointer to a function used to compare two elements (see `CX_ArraySort()`).
+ * @param inContext A pointer that is passed to the function `inCompare`.
+ * @param inThreads The maximum number of threads to use. The value 0 means "as many threads as online processors".
+ * Small arrays are sorted by less threads (possibly only by the calling thread, without allocating memory).
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the Array
+ * object is left untouched.
+ * @warning The function `inCompare` is called concurrently from several threads. It must be thread safe.
+ * @note The function allocates a temporary buffer as large as the buffer of the Array object.
+ * @note The sort is not stable: the order of equal elements is not preserved.
+ */
+
+bool CX_ArraySortParallel(CX_Array inArray, int(*inCompare)(void*, void*, void*), void *inContext,
+        unsigned int inThreads, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _unshare(inArray, outStatus)) {
+        return false;
+    }
+    unsigned int threads = CX_ParallelGetThreadCount(inThreads, inArray->count, CX_ARRAY_PARALLEL_GRAIN);
+    if (threads <= 1) {
+        return CX_ArraySort(inArray, inCompare, inContext);
+    }
+
+    struct _CX_ArraySortJob job;
+    _sorterInit(&job.sorter, inArray, inCompare, inContext);
+    size_t size = job.sorter.slotSize;
+    char *buffer = (char*)malloc(size * inArray->count);
+    size_t *runs = (size_t*)malloc(sizeof(size_t) * (threads + 1));
+    if (NULL == buffer || NULL == runs) {
+        free(buffer);
+        free(runs);
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return false;
+    }
+
+    // Sort the ranges.
+    job.base = (char*)inArray->elements;
+    job.count = inArray->count;
+    CX_ParallelRun(threads, &_sortTask, &job);
+
+    // Merge the sorted ranges, pair by pair.
+    size_t end;
+    unsigned int runCount = threads;
+    for (unsigned int i=0; i<threads; i++) {
+        CX_ParallelGetRange(inArray->count, i, threads, &runs[i], &end);
+    }
+    runs[threads] = inArray->count;
+
+    job.source = (char*)inArray->elements;
+    job.destination = buffer;
+    while (runCount > 1) {
+        unsigned int merged = 0;
+        for (unsigned int r=0; r<runCount; r+=2) {
+            if (r + 1 == runCount) {
+                memcpy(job.destination + runs[r] * size, job.source + runs[r] * size, (runs[r+1] - runs[r]) * size);
+            } else {
+                job.beginA = runs[r];
+                job.endA = runs[r+1];
+                job.endB = runs[r+2];
+                CX_ParallelRun(CX_ParallelGetThreadCount(threads, job.endB - job.beginA, CX_ARRAY_PARALLEL_GRAIN),
+                               &_mergeTask, &job);
+            }
+            runs[merged++] = runs[r];
+        }
+        runs[merged] = inArray->count;
+        runCount = merged;
+
+        char *tmp = job.source;
+        job.source = job.destination;
+        job.destination = tmp;
+    }
+    if (job.source != (char*)inArray->elements) {
+        memcpy(inArray->elements, job.source, size * inArray->count);
+    }
+
+    free(buffer);
+    free(runs);
+    return true;
+}
+
+/**
+ * @brief Return the position of the first element, within a sorted range of slots, which is not lower than (or,
+ * optionally, which is greater than) a given key.
+ * @param inSorter The sorter.
+ * @param inBase The first slot.
+ * @param inCount The number of slots.
+ * @param inKey The key (as it would be passed to the comparison function).
+ * @param inUpper If true, then the function looks for the first element greater than the key.
+ * @return The function returns the position of the element, or `inCount` if there is no such element.
+ */
+
+static size_t _bound(struct _CX_ArraySorter *inSorter, char *inBase, size_t inCount, void *inKey, bool inUpper) {
+    size_t low = 0;
+    size_t high = inCount;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        char *slot = inBase + middle * inSorter->slotSize;
+        int c = inSorter->compare(inSorter->byValue ? (void*)slot : *(void**)slot, inKey, inSorter->context);
+        if (c < 0 || (inUpper && 0 == c)) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+/**
+ * @brief Return the position of the first element, within a given sorted Array object, which is not lower than a
+ * given key.
+ * @param inArray The Array object. Its elements must be sorted according to the function `inCompare`.
+ * @param inKey The key. It is passed, as second argument, to the function `inCompare`.
+ * For an Array object that stores pointers, this is a pointer to an element (or to any object that the function
+ * `inCompare` can compare to an element). For an inline Array object, this is a pointer to a value.
+ * @param inCompare A pointer to a function used to compare an element with the key (see `CX_ArraySort()`).
+ * @param inContext A pointer that is passed to the function `inCompare`.
+ * @return The function returns the position of the element. If all elements are lower than the given key, then the
+ * function returns the number of elements in the Array object.
+ */
+
+size_t CX_ArrayLowerBound(CX_Array inArray, void *inKey, int(*inCompare)(void*, void*, void*), void *inContext) {
+    struct _CX_ArraySorter sorter;
+    _sorterInit(&sorter, inArray, inCompare, inContext);
+    return _bound(&sorter, (char*)inArray->elements, inArray->count, inKey, false);
+}
+
+/**
+ * @brief Search for an element equal to a given key within a given sorted Array object.
+ *
+ * The search costs O(log n) comparisons.
+ * @param inArray The Array object. Its elements must be sorted according to the function `inCompare`.
+ * @param inKey The key (see `CX_ArrayLowerBound()`).
+ * @param inCompare A pointer to a function used to compare an element with the key (see `CX_ArraySort()`).
+ * @param inContext A pointer that is passed to the function `inCompare`.
+ * @param outIndex Optional pointer to a memory location used to store the position of the found element. If no element
+ * is found, then the position where the key should be inserted is stored. This value may be NULL.
+ * @return If an element is found, then the function returns it (as `CX_ArrayGetElementAt()` does).
+ * Otherwise, the function returns the value NULL.
+ */
+
+void *CX_ArrayBinarySearch(CX_Array inArray, void *inKey, int(*inCompare)(void*, void*, void*), void *inContext,
+        size_t *outIndex) {
+    size_t index = CX_ArrayLowerBound(inArray, inKey, inCompare, inContext);
+    if (NULL != outIndex) {
+        *outIndex = index;
+    }
+    if (index == inArray->count) {
+        return NULL;
+    }
+    void *element = CX_ARRAY_ELEMENT_AT(inArray, index);
+    return 0 == inCompare(element, inKey, inContext) ? element : NULL;
+}
+
+/**
+ * @brief Insert an element into a given sorted Array object, so that the Array object remains sorted.
+ *
+ * The element is inserted after the elements that are equal to it.
+ * @param inArray The Array object. Its elements must be sorted according to the function `inCompare`.
+ * @param inElement The element to insert. For an Array object that stores pointers, this is a pointer to the element
+ * (which is not cloned). For an inline Array object, this is a pointer to the value to copy.
+ * @param inCompare A pointer to a function used to compare two elements (see `CX_ArraySort()`).
+ * @param inContext A pointer that is passed to the function `inCompare`.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a pointer to the inserted element (for an inline Array
+ * object, a pointer to the copy of the value stored within the array). Otherwise, the function returns the value NULL
+ * (which means that the process ran out of memory).
+ */
+
+void *CX_ArrayInsertSorted(CX_Array inArray, void *inElement, int(*inCompare)(void*, void*, void*), void *inContext,
+        CX_Status outStatus) {
+    struct _CX_ArraySorter sorter;
+    _sorterInit(&sorter, inArray, inCompare, inContext);
+    size_t index = _bound(&sorter, (char*)inArray->elements, inArray->count, inElement, true);
+    if (! CX_ArrayInsertRange(inArray, sorter.byValue ? inElement : (void*)&inElement, 1, index,
+                              outStatus)) {
+        return NULL;
+    }
+    return CX_ARRAY_ELEMENT_AT(inArray, index);
+}
+
+/**
+ * @brief Search for elements within a given Array object, and store their positions into a buffer provided by the
+ * caller.
+ *
+ * Unlike `CX_ArraySearch()`, this function does not allocate memory.
+ * @param inArray The Array object. It may be an inline Array object (see `CX_ArrayCreateInline()`).
+ * @param inKeep A pointer to a function used to decide whether an element should be kept or not
+ * (see `CX_ArraySearchEx()`).
+ * @param inContext A pointer that is passed to the function `inKeep`.
+ * @param outIndices A buffer used to store the positions of the kept elements, in increasing order.
+ * If this value is NULL, then the kept elements are only counted.
+ * @param inMaxIndices The maximum number of positions to find. The search stops as soon as this number of elements
+ * have been kept. If `outIndices` is not NULL, then it must be able to hold (at least) this number of positions.
+ * Use the value `SIZE_MAX` in order to examine all the elements.
+ * @return The function returns the number of kept elements (which is lower than, or equal to, `inMaxIndices`).
+ * @example Count the elements that match a predicate:
+ * size_t count = CX_ArraySearchIndices(array, &keep, NULL, NULL, SIZE_MAX);
+ * @example Find the positions of the first 10 elements that match a predicate:
+ * size_t indices[10];
+ * size_t count = CX_ArraySearchIndices(array, &keep, NULL, indices, 10);
+ */
+
+size_t CX_ArraySearchIndices(CX_Array inArray, bool(*inKeep)(void*, void*), void *inContext,
+        size_t *outIndices, size_t inMaxIndices) {
+    size_t found = 0;
+    for (size_t i=0; i<inArray->count && found < inMaxIndices; i++) {
+        if (inKeep(CX_ARRAY_ELEMENT_AT(inArray, i), inContext)) {
+            if (NULL != outIndices) {
+                outIndices[found] = i;
+            }
+            found++;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Search for elements within a given Array object, and mark them into a bitmap provided by the caller.
+ *
+ * Unlike `CX_ArraySearch()`, this function does not allocate memory.
+ * @param inArray The Array object. It may be an inline Array object (see `CX_ArrayCreateInline()`).
+ * @param inKeep A pointer to a function used to decide whether an element should be kept or not
+ * (see `CX_ArraySearchEx()`).
+ * @param inContext A pointer that is passed to the function `inKeep`.
+ * @param outBitmap The bitmap. It must contain (at least) `(CX_ArrayGetCount(inArray) + 7) / 8` bytes.
+ * If the element at position `i` is kept, then the bit `i % 8` of the byte `i / 8` is set. Otherwise, it is cleared.
+ * @return The function returns the number of kept elements.
+ */
+
+size_t CX_ArraySearchBitmap(CX_Array inArray, bool(*inKeep)(void*, void*), void *inContext,
+        unsigned char *outBitmap) {
+    size_t found = 0;
+    memset(outBitmap, 0, (inArray->count + 7) / 8);
+    for (size_t i=0; i<inArray->count; i++) {
+        if (inKeep(CX_ARRAY_ELEMENT_AT(inArray, i), inContext)) {
+            outBitmap[i / 8] |= (unsigned char)(1u << (i % 8));
+            found++;
+        }
+    }
+    return found;
+}
 
 /**
- * @brief Create a new Array object.
- * @param elementDisposer Pointer to a function used to free an element of the Array object.
- * The signature of this function is:  void elementDisposer (void *element)
- *    Where:
- *    - "element" is a pointer to the element to free.
- * If the elements don't need to be freed (or should not), then you should pass the value NULL for this parameter.
- * @return elementCloner  Pointer to a function used to clone an element of the Array object.
- * The signature of this function is:  void* elementCloner (void *element, CX_Status status)
- *    Where:
- *    - "element" is a pointer to the element to free.
- *    - "status" is a status container.
- *    The function must return a pointer to a clone of the given element.
- *    Upon successful completion the function must return a pointer to the cloned element.
- *    Otherwise, the function must return the value NULL.
- * @return The function returns a new dynamic array.
- * @warning Please keep in minf that the returned Array object has been **dynamically allocated**.
+ * @brief Initialise an iterator over the elements of a given Array object that match a given predicate.
+ *
+ * The elements are examined lazily, as the iterator advances (see `CX_ArrayFilterIteratorNext()`). The iterator does
+ * not allocate memory, and it does not need to be disposed.
+ * @param outIterator The iterator to initialise. It is allocated by the caller.
+ * @param inArray The Array object. It may be an inline Array object (see `CX_ArrayCreateInline()`).
+ * @param inKeep A pointer to a function used to decide whether an element should be kept or not
+ * (see `CX_ArraySearchEx()`).
+ * @param inContext A pointer that is passed to the function `inKeep`.
+ * @warning The Array object must not be modified while it is being iterated.
+ * @example
+ * CX_ArrayFilterIterator iterator;
+ * void *element;
+ * CX_ArrayFilterIteratorInit(&iterator, array, &keep, NULL);
+ * while (CX_ArrayFilterIteratorNext(&iterator, &element, NULL)) { ... }
+ */
+
+void CX_ArrayFilterIteratorInit(CX_ArrayFilterIterator *outIterator, CX_Array inArray, bool(*inKeep)(void*, void*),
+        void *inContext) {
+    outIterator->array = inArray;
+    outIterator->keep = inKeep;
+    outIterator->context = inContext;
+    outIterator->next = 0;
+}
+
+/**
+ * @brief Advance an iterator to the next element that matches its predicate.
+ * @param inIterator The iterator (see `CX_ArrayFilterIteratorInit()`).
+ * @param outElement Pointer to a memory location used to store the element (as `CX_ArrayGetElementAt()` would return
+ * it). This value may be NULL.
+ * @param outIndex Pointer to a memory location used to store the position of the element. This value may be NULL.
+ * @return If an element is found, then the function returns the value true.
+ * Otherwise, the function returns the value false (which means that the iteration is over).
+ */
+
+bool CX_ArrayFilterIteratorNext(CX_ArrayFilterIterator *inIterator, void **outElement, size_t *outIndex) {
+    CX_Array array = inIterator->array;
+    while (inIterator->next < array->count) {
+        size_t index = inIterator->next++;
+        void *element = CX_ARRAY_ELEMENT_AT(array, index);
+        if (inIterator->keep(element, inIterator->context)) {
+            if (NULL != outElement) {
+                *outElement = element;
+            }
+            if (NULL != outIndex) {
+                *outIndex = index;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Enable, or disable, the copy-on-write mode for a given Array object.
+ *
+ * If the copy-on-write mode is enabled, then `CX_ArrayDup()` does not clone the elements of the Array object: the
+ * clone shares the buffer of the Array object, and the operation costs O(1) in time and memory. The elements are
+ * copied (see below) when one of the Array objects that share them is modified through the functions of this module
+ * (`CX_ArrayAdd()`, `CX_ArrayReplaceAt()`, `CX_ArrayRemove()`, `CX_ArraySort()`...). The modified Array object gets its
+ * own copy of the elements, while the other ones keep the original elements:
+ * - If the Array object stores pointers, then the elements are cloned, using the function provided at the array
+ *   creation (see `CX_ArrayCreate()`). If no such function was provided, then only the pointers are copied. Thus, an
+ *   Array object that has a disposer but no cloner cannot be shared (`CX_ArrayDup()` clones it as usual, which fails).
+ * - If the Array object is an inline Array object, then the values are copied byte by byte. Please note that an inline
+ *   Array object that has a disposer cannot be shared (`CX_ArrayDup()` clones it as usual, which fails).
+ *
+ * The clones inherit the mode of the original Array object.
+ * @param inArray The Array object.
+ * @param inEnable This flag tells whether the copy-on-write mode should be enabled (true) or disabled (false).
+ * Disabling the mode does not copy the elements that are already shared.
+ * @warning The elements that are modified in place (through the pointers returned by `CX_ArrayGetElements()`,
+ * `CX_ArrayGetElementAt()`, `CX_ArrayGetValues()`...) are not copied: the modification is visible from all the Array
+ * objects that share them.
+ * @note Array objects that share elements may be used (and disposed) by different threads.
+ */
+
+void CX_ArraySetCopyOnWrite(CX_Array inArray, bool inEnable) {
+    inArray->copyOnWrite = inEnable;
+}
+
+/**
+ * @brief Test whether a given Array object shares its elements with other Array objects.
+ * @param inArray The Array object.
+ * @return If the Array object shares its elements with (at least) one other Array object, then the function returns
+ * the value true. Otherwise, it returns the value false.
+ */
+
+bool CX_ArrayIsShared(CX_Array inArray) {
+    return NULL != inArray->shared && __atomic_load_n(inArray->shared, __ATOMIC_ACQUIRE) > 1;
+}
+
+/**
+ * @brief The description of a parallel clone executed by `CX_ArrayDupParallel()`.
+ */
+
+struct _CX_ArrayCloneJob {
+    CX_Array array;
+    /**
+     * The buffer used to store the clones of the elements.
+     */
+    void **elements;
+    /**
+     * One Status object per task, passed to the cloner.
+     */
+    CX_Status *statuses;
+    /**
+     * One value per task: the number of elements cloned by the task.
+     */
+    size_t *cloned;
+    /**
+     * This flag is set as soon as a task fails to clone an element. Then, all the tasks stop.
+     */
+    bool failed;
+};
+
+/**
+ * @brief Clone the elements within a range of an Array object.
+ * @param inTaskIndex The index of the task.
+ * @param inTaskCount The total number of tasks.
+ * @param inJob The description of the clone (a pointer to a `struct _CX_ArrayCloneJob`).
+ * @note This function is used by the function `CX_ArrayDupParallel()`.
+ */
+
+static void _cloneTask(unsigned int inTaskIndex, unsigned int inTaskCount, void *inJob) {
+    struct _CX_ArrayCloneJob *job = (struct _CX_ArrayCloneJob*)inJob;
+    CX_Array array = job->array;
+    size_t begin, end;
+
+    CX_ParallelGetRange(array->count, inTaskIndex, inTaskCount, &begin, &end);
+    for (size_t i=begin; i<end; i++) {
+        if (__atomic_load_n(&job->failed, __ATOMIC_RELAXED)) {
+            return;
+        }
+        void *clone = array->elementCloner(array->elements[i], job->statuses[inTaskIndex]);
+        if (NULL == clone) {
+            __atomic_store_n(&job->failed, true, __ATOMIC_RELAXED);
+            return;
+        }
+        job->elements[i] = clone;
+        job->cloned[inTaskIndex] += 1;
+    }
+}
+
+/**
+ * @brief Clone a given Array object, using several threads to clone its elements.
+ *
+ * The buffer of the clone is allocated once. Then, the Array object is split into contiguous ranges, and the elements
+ * of each range are cloned by a thread. Use this function instead of `CX_ArrayDup()` for large Array objects which
+ * elements are expensive to clone (for example, an ArrayString object).
+ * @param inArray The Array object to clone.
+ * @param inThreads The maximum number of threads to use. The value 0 means "as many threads as online processors".
+ * Small arrays are cloned by less threads (possibly only the calling thread).
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a clone of the given Array object.
+ * Otherwise the function returns the value NULL. In this case, the elements that have already been cloned are
+ * disposed, and the Status object contains the error reported by the cloner (or the memory allocation error).
+ * @warning The function used to clone the elements (see `CX_ArrayCreate()`) is called concurrently from several
+ * threads. It must be thread safe.
+ * @warning Please keep in mind that the returned Array object has been **dynamically allocated**.
  * You should free it with the function `CX_ArrayDispose()`.
+ * @note Inline Array objects, and Array objects in copy-on-write mode (see `CX_ArraySetCopyOnWrite()`), are cloned by
+ * `CX_ArrayDup()`, since their elements are not cloned one by one. So are the Array objects which elements have no
+ * cloner.
  */
-CX_Array CX_ArrayCreate(void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status)) {
-    CX_Array array = (CX_Array)malloc(sizeof(struct CX_ArrayType));
+
+CX_Array CX_ArrayDupParallel(CX_Array inArray, unsigned int inThreads, CX_Status outStatus) {
+    unsigned int threads = CX_ParallelGetThreadCount(inThreads, inArray->count, CX_ARRAY_PARALLEL_CLONE_GRAIN);
+    if (threads <= 1 || 0 != inArray->elementSize || inArray->copyOnWrite || CX_ARRAY_IS_ARENA(inArray) ||
+        NULL == inArray->elementCloner) {
+        return CX_ArrayDup(inArray, outStatus);
+    }
+    CX_StatusReset(outStatus);
+    CX_ObjectManager m = CX_ObjectManagerCreate();
+
+    CX_Array clone = CX_ArrayCreate(_cloneDisposer(inArray), inArray->elementCloner); // To free
+    if (NULL == clone) {
+        CX_ObjectManagerDisposeOnError(m);
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    CX_OBJECT_MANAGER_ADD_RESULT(m, clone, CX_ArrayDispose);
+    clone->deque = inArray->deque;
+    clone->hugePageThreshold = inArray->hugePageThreshold;
+
+    struct _CX_ArrayCloneJob job;
+    job.array = inArray;
+    job.failed = false;
+    job.statuses = (CX_Status*)calloc(threads, sizeof(CX_Status));
+    CX_OBJECT_MANAGER_ADD(m, job.statuses, free);
+    job.cloned = (size_t*)calloc(threads, sizeof(size_t));
+    CX_OBJECT_MANAGER_ADD(m, job.cloned, free);
+    if (NULL == job.statuses || NULL == job.cloned || ! _setCapacity(clone, inArray->count)) {
+        CX_ObjectManagerDisposeOnError(m);
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    job.elements = clone->elements;
+    for (unsigned int i=0; i<threads; i++) {
+        job.statuses[i] = CX_StatusCreate();
+        if (NULL == job.statuses[i]) {
+            CX_ObjectManagerDisposeOnError(m);
+            CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+            return NULL;
+        }
+        CX_OBJECT_MANAGER_ADD(m, job.statuses[i], CX_StatusDispose);
+    }
+
+    CX_ParallelRun(threads, &_cloneTask, &job);
+
+    if (job.failed) {
+        // Dispose the elements that have been cloned, and report the first error.
+        bool reported = false;
+        for (unsigned int i=0; i<threads; i++) {
+            size_t begin, end;
+            CX_ParallelGetRange(inArray->count, i, threads, &begin, &end);
+            for (size_t j=begin; j<begin+job.cloned[i] && NULL != clone->elementDisposer; j++) {
+                clone->elementDisposer(job.elements[j]);
+            }
+            if (! reported && CX_StatusIsFailure(job.statuses[i])) {
+                CX_StatusSetError(outStatus, job.statuses[i]->code, "%s", CX_StatusGetMessage(job.statuses[i]));
+                reported = true;
+            }
+        }
+        if (! reported) {
+            CX_StatusSetError(outStatus, 0, "Cannot clone an element!");
+        }
+        CX_ObjectManagerDisposeOnError(m);
+        return NULL;
+    }
+
+    clone->count = inArray->count;
+    CX_ObjectManagerDispose(m);
+    return clone;
+}
+
+/**
+ * @brief Create a new deque Array object: an Array object that supports insertions and removals at both ends in O(1)
+ * amortized time.
+ *
+ * A deque Array object keeps free slots before its first element, as well as after its last element. Thus, inserting
+ * (or removing) an element at the beginning of the Array object (with `CX_ArrayPushFront()`,
+ * `CX_ArrayInsertAt(array, element, 0, status)` or `CX_ArrayRemove(array, 0, free, status)`) does not move the other
+ * elements. More generally, inserting (or removing) an element moves the elements that precede it, or the ones that
+ * follow it, whichever are less numerous. The elements remain contiguous, so that all the other functions of this
+ * module can be used on a deque Array object.
+ * @param elementDisposer Pointer to a function used to free an element of the Array object (see `CX_ArrayCreate()`).
+ * @param elementCloner Pointer to a function used to clone an element of the Array object (see `CX_ArrayCreate()`).
+ * @return Upon successful completion the function returns a new deque Array object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ * @warning Please keep in mind that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`.
+ * @note The pointer returned by `CX_ArrayGetElements()` changes when an element is inserted, or removed, at the
+ * beginning of the Array object.
+ */
+
+CX_Array CX_ArrayCreateDeque(void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status)) {
+    CX_Array array = CX_ArrayCreate(elementDisposer, elementCloner);
     if (NULL == array) {
         return NULL;
     }
-    array->elements = NULL;
-    array->count = 0;
-    array->elementDisposer = elementDisposer;
-    array->elementCloner = elementCloner;
+    array->deque = true;
     return array;
 }
 
 /**
- * @brief Free all resources allocated for a given Array object.
- * @param inArray The Array object to free.
+ * @brief Add an element at the beginning of a given Array object.
+ * @param inArray The Array object.
+ * @param inElement A pointer to the element to add to the beginning of the Array object.
+ * Please note that the added element is not cloned!
+ * @return Upon successful completion the function returns a pointer to the element added element (that is, it returns
+ * the value of `inElement`). Otherwise, the function returns the value NULL. This means that the system could not
+ * allocate memory, or that the Array object is an inline Array object (use `CX_ArrayInsertValueAt()` instead).
+ * @note If the Array object is a deque (see `CX_ArrayCreateDeque()`), then this operation costs O(1) amortized.
+ * Otherwise, it costs O(N), since all the elements are moved.
  */
-void CX_ArrayDispose(CX_Array inArray) {
-    for (unsigned int i=0; i<inArray->count; i++) {
-        if (NULL != inArray->elementDisposer) {
-            inArray->elementDisposer(inArray->elements[i]);
+
+void *CX_ArrayPushFront(CX_Array inArray, void *inElement) {
+    if (! _storesPointers(inArray, "CX_ArrayInsertValueAt", NULL) || ! _unshare(inArray, NULL) ||
+        ! _openGap(inArray, 0, 1)) {
+        return NULL;
+    }
+    inArray->elements[0] = inElement;
+    return inElement;
+}
+
+/**
+ * @brief Create a new arena Array object: an Array object that owns the memory used to store its elements.
+ *
+ * The elements are allocated with the function `CX_ArrayAllocElement()`, from large chunks of memory that belong to
+ * the Array object. The elements are not freed one by one: when the Array object is disposed, the chunks are freed.
+ * Thus, disposing the Array object costs a few calls to `free()`, no matter how many elements it contains.
+ * @return Upon successful completion the function returns a new arena Array object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ * @warning Please keep in mind that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`. All the elements allocated with `CX_ArrayAllocElement()`
+ * are freed at this time (even if they have been removed from the Array object).
+ * @note The elements of an arena Array object must not reference resources that need to be released, since no
+ * disposer is called. Removing an element (even with `inFree` set to true) does not release its memory.
+ * @note An arena Array object cannot be cloned.
+ */
+
+CX_Array CX_ArrayCreateArena() {
+    return CX_ArrayCreate(&_arenaDisposer, NULL);
+}
+
+/**
+ * @brief Allocate memory for an element of a given arena Array object.
+ *
+ * The allocated element is **not** added to the Array object: use `CX_ArrayAdd()` (or any other function) to add it.
+ * @param inArray The arena Array object (see `CX_ArrayCreateArena()`).
+ * @param inSize The size, in bytes, of the element.
+ * @return Upon successful completion the function returns a pointer to the allocated memory. The returned address is
+ * suitably aligned for any type of element.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory, or that the Array
+ * object is not an arena Array object).
+ * @warning The allocated memory belongs to the Array object. It must not be freed: it is freed when the Array object
+ * is disposed.
+ * @example
+ * CX_Array array = CX_ArrayCreateArena();
+ * int *element = (int*)CX_ArrayAllocElement(array, sizeof(int));
+ * *element = 10;
+ * CX_ArrayAdd(array, element);
+ */
+
+void *CX_ArrayAllocElement(CX_Array inArray, size_t inSize) {
+    if (! CX_ARRAY_IS_ARENA(inArray) || inSize > SIZE_MAX - CX_ARRAY_ARENA_ALIGNMENT - CX_ARRAY_ARENA_HEADER_SIZE) {
+        return NULL;
+    }
+    size_t size = CX_ARRAY_ARENA_ALIGN(0 == inSize ? 1 : inSize);
+    struct CX_ArrayArenaChunk *chunk = inArray->arena;
+
+    if (NULL == chunk || chunk->size - chunk->used < size) {
+        // The chunks get larger and larger, up to a given limit.
+        size_t chunkSize = NULL == chunk ? CX_ARRAY_ARENA_MIN_CHUNK_SIZE : chunk->size * 2;
+        if (chunkSize > CX_ARRAY_ARENA_MAX_CHUNK_SIZE) {
+            chunkSize = CX_ARRAY_ARENA_MAX_CHUNK_SIZE;
         }
+        if (chunkSize < size) {
+            chunkSize = size;
+        }
+        struct CX_ArrayArenaChunk *newChunk =
+                (struct CX_ArrayArenaChunk*)malloc(CX_ARRAY_ARENA_HEADER_SIZE + chunkSize);
+        if (NULL == newChunk) {
+            return NULL;
+        }
+        newChunk->previous = chunk;
+        newChunk->size = chunkSize;
+        newChunk->used = 0;
+        inArray->arena = chunk = newChunk;
+    }
+
+    void *element = (char*)chunk + CX_ARRAY_ARENA_HEADER_SIZE + chunk->used;
+    chunk->used += size;
+    return element;
+}
+
+/**
+ * @brief Back the large buffers of a given Array object with huge pages.
+ *
+ * When the buffer that holds the elements (see `CX_ArrayGetElements()`) must be (re)allocated, and if its size is
+ * greater than, or equal to, the given threshold, then the buffer is mapped with `mmap()` and the kernel is advised to
+ * back it with (transparent) huge pages (`MADV_HUGEPAGE`). This reduces the number of TLB misses when scanning arrays
+ * of several gigabytes. Smaller buffers are allocated with `malloc()`.
+ * @param inArray The Array object.
+ * @param inThreshold The size, in bytes, above which the buffer is mapped. The value 0 disables the mapping.
+ * The new threshold applies to the next reallocation of the buffer (call `CX_ArrayReserve()` to force it).
+ * @note Clones inherit the threshold of the original Array object.
+ * @note On systems that do not support anonymous mappings, this function has no effect.
+ * @note Mapped buffers are rounded up to a multiple of 2 MB. Thus, the threshold should not be lower than this size.
+ */
+
+void CX_ArraySetHugePageThreshold(CX_Array inArray, size_t inThreshold) {
+    inArray->hugePageThreshold = inThreshold;
+}
+
+/**
+ * @brief Return the number of threads used by a bulk algorithm (for-each, map or reduce).
+ * @param inArray The Array object.
+ * @param inGrain The minimum number of elements a thread should process. The value 0 means "the default grain".
+ * @param inThreads The maximum number of threads. The value 0 means "as many threads as online processors".
+ * @return The function returns the number of threads.
+ */
+
+static unsigned int _bulkThreadCount(CX_Array inArray, size_t inGrain, unsigned int inThreads) {
+    return CX_ParallelGetThreadCount(inThreads, inArray->count, 0 == inGrain ? CX_ARRAY_PARALLEL_GRAIN : inGrain);
+}
+
+/**
+ * @brief The description of a parallel for-each (see `CX_ArrayForEachParallel()`).
+ */
+
+struct _CX_ArrayForEachJob {
+    CX_Array array;
+    void(*function)(void*, size_t, void*);
+    void *context;
+};
+
+/**
+ * @brief Call a function on the elements within a range of an Array object.
+ * @param inTaskIndex The index of the task.
+ * @param inTaskCount The total number of tasks.
+ * @param inJob The description of the for-each (a pointer to a `struct _CX_ArrayForEachJob`).
+ * @note This function is used by the function `CX_ArrayForEachParallel()`.
+ */
+
+static void _forEachTask(unsigned int inTaskIndex, unsigned int inTaskCount, void *inJob) {
+    struct _CX_ArrayForEachJob *job = (struct _CX_ArrayForEachJob*)inJob;
+    CX_Array array = job->array;
+    size_t begin, end;
+
+    CX_ParallelGetRange(array->count, inTaskIndex, inTaskCount, &begin, &end);
+    for (size_t i=begin; i<end; i++) {
+        job->function(CX_ARRAY_ELEMENT_AT(array, i), i, job->context);
     }
-    if (NULL != inArray->elements) {
-        free(inArray->elements);
+}
+
+/**
+ * @brief Call a given function on all the elements of a given Array object, using several threads.
+ *
+ * The Array object is split into contiguous ranges, and the elements of each range are processed by a thread of the
+ * shared pool (see `CX_ParallelRun()`).
+ * @param inArray The Array object. It may be an inline Array object (see `CX_ArrayCreateInline()`).
+ * @param inFunction A pointer to the function to call.
+ * The signature of this function is: `void function (void *element, size_t index, void *context)`.
+ * `element`: this parameter will be assigned a pointer to an element of the array (for an inline Array object, a
+ * pointer to the value, which may be modified in place).
+ * `index`: this parameter will be assigned the position of the element.
+ * `context`: this parameter will be assigned the value of the parameter `inContext`.
+ * @param inContext A pointer that is passed to the function `inFunction`.
+ * @param inGrain The minimum number of elements a thread should process. The value 0 means "the default grain".
+ * Use a small grain if the function is expensive.
+ * @param inThreads The maximum number of threads to use. The value 0 means "as many threads as online processors".
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the elements of a shared Array object could not be copied,
+ * see `CX_ArraySetCopyOnWrite()`). In this case, the function `inFunction` is not called.
+ * @warning The function `inFunction` is called concurrently from several threads. It must be thread safe.
+ */
+
+bool CX_ArrayForEachParallel(CX_Array inArray, void(*inFunction)(void*, size_t, void*), void *inContext,
+        size_t inGrain, unsigned int inThreads, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _unshare(inArray, outStatus)) {
+        return false;
     }
-    free(inArray);
+    struct _CX_ArrayForEachJob job;
+    job.array = inArray;
+    job.function = inFunction;
+    job.context = inContext;
+    CX_ParallelRun(_bulkThreadCount(inArray, inGrain, inThreads), &_forEachTask, &job);
+    return true;
 }
 
 /**
- * @brief Return the number of elements in the Array object.
- * @param inArray The Array object we want to get the number of elements from.
- * @return The function returns the number of elements in the given Array object.
+ * @brief The description of a parallel map (see `CX_ArrayMapParallel()`).
  */
-unsigned int CX_ArrayGetCount(CX_Array inArray) {
-    return inArray->count;
+
+struct _CX_ArrayMapJob {
+    CX_Array array;
+    void*(*map)(void*, void*, CX_Status);
+    void *context;
+    /**
+     * The buffer used to store the results.
+     */
+    void **elements;
+    /**
+     * One Status object per task, passed to the function `map`.
+     */
+    CX_Status *statuses;
+    /**
+     * One value per task: the number of elements mapped by the task.
+     */
+    size_t *mapped;
+    /**
+     * This flag is set as soon as a task fails to map an element. Then, all the tasks stop.
+     */
+    bool failed;
+};
+
+/**
+ * @brief Map the elements within a range of an Array object.
+ * @param inTaskIndex The index of the task.
+ * @param inTaskCount The total number of tasks.
+ * @param inJob The description of the map (a pointer to a `struct _CX_ArrayMapJob`).
+ * @note This function is used by the function `CX_ArrayMapParallel()`.
+ */
+
+static void _mapTask(unsigned int inTaskIndex, unsigned int inTaskCount, void *inJob) {
+    struct _CX_ArrayMapJob *job = (struct _CX_ArrayMapJob*)inJob;
+    CX_Array array = job->array;
+    size_t begin, end;
+
+    CX_ParallelGetRange(array->count, inTaskIndex, inTaskCount, &begin, &end);
+    for (size_t i=begin; i<end; i++) {
+        if (__atomic_load_n(&job->failed, __ATOMIC_RELAXED)) {
+            return;
+        }
+        void *result = job->map(CX_ARRAY_ELEMENT_AT(array, i), job->context, job->statuses[inTaskIndex]);
+        if (NULL == result) {
+            __atomic_store_n(&job->failed, true, __ATOMIC_RELAXED);
+            return;
+        }
+        job->elements[i] = result;
+        job->mapped[inTaskIndex] += 1;
+    }
+}
+
+/**
+ * @brief Create a new Array object that contains the results of a given function applied to all the elements of a
+ * given Array object, using several threads.
+ *
+ * The buffer of the new Array object is allocated once. Then, the given Array object is split into contiguous
+ * ranges, and the elements of each range are mapped by a thread of the shared pool (see `CX_ParallelRun()`). The
+ * result of the element at position `i` is stored at position `i`.
+ * @param inArray The Array object. It may be an inline Array object (see `CX_ArrayCreateInline()`).
+ * @param inMap A pointer to the function used to map an element.
+ * The signature of this function is: `void *map (void *element, void *context, CX_Status status)`.
+ * `element`: this parameter will be assigned a pointer to an element of the array (for an inline Array object, a
+ * pointer to the value).
+ * `context`: this parameter will be assigned the value of the parameter `inContext`.
+ * `status`: this parameter will be assigned a Status object used to report an error.
+ * The function returns a pointer to the result, or the value NULL if an error occurred.
+ * @param inContext A pointer that is passed to the function `inMap`.
+ * @param elementDisposer Pointer to a function used to free an element of the new Array object (see
+ * `CX_ArrayCreate()`).
+ * @param elementCloner Pointer to a function used to clone an element of the new Array object (see
+ * `CX_ArrayCreate()`).
+ * @param inGrain The minimum number of elements a thread should process. The value 0 means "the default grain".
+ * @param inThreads The maximum number of threads to use. The value 0 means "as many threads as online processors".
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a new Array object (which may be empty).
+ * Otherwise the function returns the value NULL. In this case, the results that have already been computed are
+ * disposed (using `elementDisposer`), and the Status object contains the first error reported by `inMap`.
+ * @warning The function `inMap` is called concurrently from several threads. It must be thread safe.
+ * @warning Please keep in mind that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`.
+ */
+
+CX_Array CX_ArrayMapParallel(CX_Array inArray, void*(*inMap)(void*, void*, CX_Status), void *inContext,
+        void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status), size_t inGrain,
+        unsigned int inThreads, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    unsigned int threads = _bulkThreadCount(inArray, inGrain, inThreads);
+    CX_ObjectManager m = CX_ObjectManagerCreate();
+
+    CX_Array result = CX_ArrayCreate(elementDisposer, elementCloner); // To free
+    if (NULL == result) {
+        CX_ObjectManagerDisposeOnError(m);
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    CX_OBJECT_MANAGER_ADD_RESULT(m, result, CX_ArrayDispose);
+    if (0 == inArray->count) {
+        CX_ObjectManagerDispose(m);
+        return result;
+    }
+
+    struct _CX_ArrayMapJob job;
+    job.array = inArray;
+    job.map = inMap;
+    job.context = inContext;
+    job.failed = false;
+    job.statuses = (CX_Status*)calloc(threads, sizeof(CX_Status));
+    CX_OBJECT_MANAGER_ADD(m, job.statuses, free);
+    job.mapped = (size_t*)calloc(threads, sizeof(size_t));
+    CX_OBJECT_MANAGER_ADD(m, job.mapped, free);
+    if (NULL == job.statuses || NULL == job.mapped || ! _setCapacity(result, inArray->count)) {
+        CX_ObjectManagerDisposeOnError(m);
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    job.elements = result->elements;
+    for (unsigned int i=0; i<threads; i++) {
+        job.statuses[i] = CX_StatusCreate();
+        if (NULL == job.statuses[i]) {
+            CX_ObjectManagerDisposeOnError(m);
+            CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+            return NULL;
+        }
+        CX_OBJECT_MANAGER_ADD(m, job.statuses[i], CX_StatusDispose);
+    }
+
+    CX_ParallelRun(threads, &_mapTask, &job);
+
+    if (job.failed) {
+        // Dispose the results that have been computed, and report the first error.
+        bool reported = false;
+        for (unsigned int i=0; i<threads; i++) {
+            size_t begin, end;
+            CX_ParallelGetRange(inArray->count, i, threads, &begin, &end);
+            for (size_t j=begin; j<begin+job.mapped[i] && NULL != elementDisposer; j++) {
+                elementDisposer(job.elements[j]);
+            }
+            if (! reported && CX_StatusIsFailure(job.statuses[i])) {
+                CX_StatusSetError(outStatus, job.statuses[i]->code, "%s", CX_StatusGetMessage(job.statuses[i]));
+                reported = true;
+            }
+        }
+        if (! reported) {
+            CX_StatusSetError(outStatus, 0, "Cannot map an element!");
+        }
+        CX_ObjectManagerDisposeOnError(m);
+        return NULL;
+    }
+
+    result->count = inArray->count;
+    CX_ObjectManagerDispose(m);
+    return result;
+}
+
+/**
+ * @brief The description of a parallel reduction (see `CX_ArrayReduceParallel()`).
+ */
+
+struct _CX_ArrayReduceJob {
+    CX_Array array;
+    void(*accumulate)(void*, void*, void*);
+    void *context;
+    /**
+     * The initial value of the accumulators.
+     */
+    void *identity;
+    size_t accumulatorSize;
+    /**
+     * One accumulator per task.
+     */
+    unsigned char *partials;
+};
+
+/**
+ * @brief Reduce the elements within a range of an Array object.
+ * @param inTaskIndex The index of the task.
+ * @param inTaskCount The total number of tasks.
+ * @param inJob The description of the reduction (a pointer to a `struct _CX_ArrayReduceJob`).
+ * @note This function is used by the function `CX_ArrayReduceParallel()`.
+ */
+
+static void _reduceTask(unsigned int inTaskIndex, unsigned int inTaskCount, void *inJob) {
+    struct _CX_ArrayReduceJob *job = (struct _CX_ArrayReduceJob*)inJob;
+    CX_Array array = job->array;
+    void *accumulator = job->partials + job->accumulatorSize * inTaskIndex;
+    size_t begin, end;
+
+    memcpy(accumulator, job->identity, job->accumulatorSize);
+    CX_ParallelGetRange(array->count, inTaskIndex, inTaskCount, &begin, &end);
+    for (size_t i=begin; i<end; i++) {
+        job->accumulate(accumulator, CX_ARRAY_ELEMENT_AT(array, i), job->context);
+    }
+}
+
+/**
+ * @brief Reduce all the elements of a given Array object to a single value, using several threads.
+ *
+ * The Array object is split into contiguous ranges. Each range is reduced by a thread of the shared pool (see
+ * `CX_ParallelRun()`) into its own accumulator, which initial value is the identity. Then, the accumulators are
+ * combined, in the order of the ranges. Thus, the operation must be associative, but it does not need to be
+ * commutative.
+ * @param inArray The Array object. It may be an inline Array object (see `CX_ArrayCreateInline()`).
+ * @param ioAccumulator A pointer to the accumulator. On input, it contains the identity of the operation (for
+ * example, 0 for a sum). On output, it contains the result.
+ * @param inAccumulatorSize The size of the accumulator, in bytes.
+ * @param inAccumulate A pointer to the function used to add an element to an accumulator.
+ * The signature of this function is: `void accumulate (void *accumulator, void *element, void *context)`.
+ * @param inCombine A pointer to the function used to add an accumulator to another one.
+ * The signature of this function is: `void combine (void *accumulator, void *partial, void *context)`.
+ * @param inContext A pointer that is passed to the functions `inAccumulate` and `inCombine`.
+ * @param inGrain The minimum number of elements a thread should process. The value 0 means "the default grain".
+ * @param inThreads The maximum number of threads to use. The value 0 means "as many threads as online processors".
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the
+ * accumulator is left untouched.
+ * @warning The function `inAccumulate` is called concurrently from several threads. It must be thread safe.
+ */
+
+bool CX_ArrayReduceParallel(CX_Array inArray, void *ioAccumulator, size_t inAccumulatorSize,
+        void(*inAccumulate)(void*, void*, void*), void(*inCombine)(void*, void*, void*), void *inContext,
+        size_t inGrain, unsigned int inThreads, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    unsigned int threads = _bulkThreadCount(inArray, inGrain, inThreads);
+    if (1 == threads) {
+        for (size_t i=0; i<inArray->count; i++) {
+            inAccumulate(ioAccumulator, CX_ARRAY_ELEMENT_AT(inArray, i), inContext);
+        }
+        return true;
+    }
+
+    struct _CX_ArrayReduceJob job;
+    job.array = inArray;
+    job.accumulate = inAccumulate;
+    job.context = inContext;
+    job.identity = ioAccumulator;
+    job.accumulatorSize = inAccumulatorSize;
+    job.partials = (unsigned char*)malloc(inAccumulatorSize * threads);
+    if (NULL == job.partials) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return false;
+    }
+
+    CX_ParallelRun(threads, &_reduceTask, &job);
+
+    for (unsigned int i=0; i<threads; i++) {
+        inCombine(ioAccumulator, job.partials + inAccumulatorSize * i, inContext);
+    }
+    free(job.partials);
+    return true;
 }
 
 /**
- * @brief Returns an array that contains the elements of a given Array object.
- * @param inArray the Array object.
- * @return The function returns a pointer to an array that contains the elements of a given Array object.
+ * @brief Create a new concurrent Array object: an Array object to which several threads can add elements
+ * concurrently, without locks.
+ *
+ * The elements are added with the function `CX_ArrayConcurrentAdd()`, and stored in segments that are never
+ * reallocated: the elements never move. No thread ever waits for another one. While elements are being added, the
+ * Array object can be read with the functions `CX_ArrayConcurrentGetCount()`, `CX_ArrayConcurrentGetAt()` and
+ * `CX_ArrayConcurrentSnapshot()`. Once all the elements have been added, call `CX_ArrayConcurrentSeal()` in order to
+ * use the other functions of this module.
+ * @param elementDisposer Pointer to a function used to free an element of the Array object (see `CX_ArrayCreate()`).
+ * @param elementCloner Pointer to a function used to clone an element of the Array object (see `CX_ArrayCreate()`).
+ * @return Upon successful completion the function returns a new concurrent Array object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ * @warning Please keep in mind that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()` (once all the threads that use it are done).
+ * @warning Until the Array object is sealed, the other functions of this module see the Array object as empty.
  */
 
-void **CX_ArrayGetElements(CX_Array inArray) {
-    return inArray->elements;
+CX_Array CX_ArrayCreateConcurrent(void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status)) {
+    CX_Array array = CX_ArrayCreate(elementDisposer, elementCloner);
+    if (NULL == array) {
+        return NULL;
+    }
+    array->concurrent = (struct CX_ArrayConcurrentStore*)calloc(1, sizeof(struct CX_ArrayConcurrentStore));
+    if (NULL == array->concurrent) {
+        CX_ArrayDispose(array);
+        return NULL;
+    }
+    array->concurrent->failedAt = SIZE_MAX;
+    return array;
 }
 
 /**
- * @brief Clone a given Array object.
- * @param inArray The Array object to clone.
- * @param outStatus The Status object.
- * @return Upon successful completion the function returns a clone of the given Array object.
- * Otherwise the function returns the value NULL (which means that the process runs out of memory).
- * @warning Please keep in minf that the returned Array object has been **dynamically allocated**.
- * You should free it with the function `CX_ArrayDispose()`.
+ * @brief Add an element at the end of a given concurrent Array object.
+ *
+ * This function can be called concurrently by several threads. Each call reserves a slot (with an atomic increment),
+ * stores the element into it, and marks the slot as ready. Then, it publishes the ready slots that follow the
+ * published elements, if any. The function never waits for the other threads: an element may be published later, by
+ * the thread that fills the last slot that precedes it. Thus, the published elements always form a contiguous
+ * sequence that starts at position 0, in the order of the reservations.
+ * @param inArray The concurrent Array object (see `CX_ArrayCreateConcurrent()`).
+ * @param inElement A pointer to the element to add. Please note that the added element is not cloned!
+ * @return Upon successful completion the function returns a pointer to the added element (that is, it returns the
+ * value of `inElement`). Otherwise, the function returns the value NULL: the process ran out of memory (now, or during
+ * a previous call), or the Array object is not a concurrent Array object (or it has been sealed). In this case, the
+ * element is not added (and it still belongs to the caller).
+ * @warning Once the process ran out of memory, no more element can be added to the Array object. The elements added by
+ * other threads after the slot that could not be allocated are not published: they only appear once the Array object
+ * is sealed (see `CX_ArrayConcurrentSeal()`).
  */
-CX_Array CX_ArrayDup(CX_Array inArray, CX_Status outStatus) {
-    CX_StatusReset(outStatus);
-    CX_ObjectManager m = CX_ObjectManagerCreate();
 
-    CX_Array clone = CX_ArrayCreate(inArray->elementDisposer, inArray->elementCloner); // To free
-    if (NULL == clone) {
-        CX_ObjectManagerDisposeOnError(m);
-        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+void *CX_ArrayConcurrentAdd(CX_Array inArray, void *inElement) {
+    struct CX_ArrayConcurrentStore *store = inArray->concurrent;
+    if (NULL == store || SIZE_MAX != __atomic_load_n(&store->failedAt, __ATOMIC_RELAXED)) {
         return NULL;
     }
-    CX_OBJECT_MANAGER_ADD_RESULT(m, clone, CX_ArrayDispose);
 
-    for (int i=0; i < CX_ArrayGetCount(inArray); i++) {
-        void *element = CX_ArrayGetElementAt(inArray, i);
-        // clonedElement must not be disposed!
-        void *clonedElement = inArray->elementCloner(element, outStatus);
-        if (NULL == clonedElement) {
-            // The status is set.
-            CX_ObjectManagerDisposeOnError(m);
-            return NULL;
+    // Reserve a slot.
+    size_t index = __atomic_fetch_add(&store->reserved, 1, __ATOMIC_RELAXED);
+    size_t segment, offset;
+    _concurrentLocate(index, &segment, &offset);
+    void **slots = __atomic_load_n(&store->segments[segment], __ATOMIC_ACQUIRE);
+    if (NULL == slots) {
+        // Several threads may allocate the segment: only one of them installs it.
+        void **expected = NULL;
+        slots = (void**)calloc(_concurrentSegmentSize(segment), sizeof(void*) + sizeof(bool));
+        if (NULL != slots && ! __atomic_compare_exchange_n(&store->segments[segment], &expected, slots, false,
+                                                           __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            free(slots);
+            slots = expected;
+        } else if (NULL == slots) {
+            slots = __atomic_load_n(&store->segments[segment], __ATOMIC_ACQUIRE);
         }
-
-        if (NULL == CX_ArrayAdd(clone, clonedElement)) {
-            // The status is set.
-            CX_ObjectManagerDisposeOnError(m);
-            CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        if (NULL == slots) {
+            // This slot will never be ready: the elements that follow it will never be published.
+            size_t failedAt = __atomic_load_n(&store->failedAt, __ATOMIC_RELAXED);
+            while (index < failedAt && ! __atomic_compare_exchange_n(&store->failedAt, &failedAt, index, false,
+                                                                     __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+            }
             return NULL;
         }
     }
-    CX_ObjectManagerDispose(m);
-    return clone;
+    slots[offset] = inElement;
+    __atomic_store_n(&_concurrentReady(slots, segment)[offset], true, __ATOMIC_SEQ_CST);
+    _concurrentPublish(store);
+    return inElement;
 }
 
 /**
- * @brief Returns the element positioned at a given position within a given Array object.
- * @param inArray The Array object.
- * @param inIndex The position within the Array object.
- * @return Upon successful completion the function returns a pointer to the element.
- * Otherwise, the function returns the value NULL. This means that the given index is not valid (greater or equal to the
- * total number of elements in the Array object).
- * @note Please note that the first element of the Array object is located at the index 0.
+ * @brief Return the number of elements published within a given concurrent Array object.
+ * @param inArray The concurrent Array object (see `CX_ArrayCreateConcurrent()`).
+ * @return The function returns the number of published elements. The elements at positions [0, count[ can be read
+ * (with `CX_ArrayConcurrentGetAt()`), while other threads add elements. If the Array object is not a concurrent Array
+ * object (or if it has been sealed), then the function returns 0: use `CX_ArrayGetCount()` instead.
  */
-void *CX_ArrayGetElementAt(CX_Array inArray, unsigned int inIndex) {
-    if (inIndex >= inArray->count) {
-        return NULL;
+
+size_t CX_ArrayConcurrentGetCount(CX_Array inArray) {
+    if (NULL == inArray->concurrent) {
+        return 0;
     }
-    return inArray->elements[inIndex];
+    return _concurrentPublish(inArray->concurrent);
 }
 
 /**
- * @brief Add an element at the end of a given Array object.
- * @param inArray The Array object.
- * @param inElement A pointer to the element to add to the end of the Array object.
- * Please note that the added element is not cloned!
- * @return Upon successful completion the function returns a pointer to the element added element (that is, it returns
- * the value of `inElement`). Otherwise, the function returns the value NULL. This means that the system could not
- * allocate memory.
+ * @brief Returns the element positioned at a given position within a given concurrent Array object.
+ * @param inArray The concurrent Array object (see `CX_ArrayCreateConcurrent()`).
+ * @param inIndex The position within the Array object.
+ * @return If the element at the given position has been published, then the function returns a pointer to the
+ * element. Otherwise, the function returns the value NULL. If the Array object is not a concurrent Array object (or if
+ * it has been sealed), then the function returns the value NULL: use `CX_ArrayGetElementAt()` instead.
  */
-void *CX_ArrayAdd(CX_Array inArray, void *inElement) {
-    unsigned int currentIndex = inArray->count;
-    inArray->count += 1;
-    inArray->elements = (void**)realloc(inArray->elements, sizeof(void*) * inArray->count);
-    if (NULL == inArray->elements CX_UTEST_FORCE_TRUE(1)) {
+
+void *CX_ArrayConcurrentGetAt(CX_Array inArray, size_t inIndex) {
+    struct CX_ArrayConcurrentStore *store = inArray->concurrent;
+    if (NULL == store || inIndex >= __atomic_load_n(&store->published, __ATOMIC_ACQUIRE)) {
         return NULL;
     }
-    *(inArray->elements + currentIndex) = inElement;
-    return inElement;
+    size_t segment, offset;
+    _concurrentLocate(inIndex, &segment, &offset);
+    return __atomic_load_n(&store->segments[segment], __ATOMIC_ACQUIRE)[offset];
 }
 
 /**
- * @brief Remove an element located to a given position within a given Array object.
- * @param inArray The Array object.
- * @param inIndex The position where the element will be inserted.
- * @param inFree This flag tells the function whether the removed element should be freed or not.
- * If the value of this parameter is true, then the removed element will be freed, using the function provided at the
- * array creation (see function CX_ArrayCreate()).
+ * @brief Copy the elements published within a given concurrent Array object into a new Array object.
+ *
+ * This function can be called while other threads add elements: the returned Array object contains all the elements
+ * published when the function is called, in order.
+ * @param inArray The concurrent Array object (see `CX_ArrayCreateConcurrent()`).
  * @param outStatus The Status object.
- * @return In order to test the status of the operation, you must examine the Status object outStatus.
- * @note Please note that the first element of the Array object is located at the index 0.
+ * @return Upon successful completion the function returns a new Array object (which may be empty). If the given Array
+ * object is not a concurrent Array object (or if it has been sealed), then the returned Array object is empty.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ * @warning Please keep in mind that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`. The returned Array object has no disposer: the elements
+ * still belong to the concurrent Array object.
  */
-void *CX_ArrayRemove(CX_Array inArray, unsigned int inIndex, bool inFree, CX_Status outStatus) {
+
+CX_Array CX_ArrayConcurrentSnapshot(CX_Array inArray, CX_Status outStatus) {
     CX_StatusReset(outStatus);
-    if (inIndex >= inArray->count) {
-        CX_StatusSetError(outStatus, 0, "The given index (%u) exceeds the number of elements in the array (%u).",
-                          inIndex, inArray->count);
+    size_t count = CX_ArrayConcurrentGetCount(inArray);
+    CX_Array snapshot = CX_ArrayCreate(NULL, inArray->elementCloner);
+    if (NULL == snapshot || ! _setCapacity(snapshot, count)) {
+        if (NULL != snapshot) {
+            CX_ArrayDispose(snapshot);
+        }
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
         return NULL;
     }
+    _concurrentCopy(inArray->concurrent, count, snapshot->elements);
+    snapshot->count = count;
+    return snapshot;
+}
 
-    void *element = inArray->elements[inIndex];
+/**
+ * @brief Turn a concurrent Array object into a regular Array object.
+ *
+ * The added elements are moved into the (contiguous) buffer of the Array object, in the order of the reservations, and
+ * the segmented storage is freed. If the process ran out of memory while elements were added, then the elements added
+ * after the slot that could not be allocated follow the published elements. Then, all the functions of this module
+ * can be used with the Array object, but `CX_ArrayConcurrentAdd()` can no longer be used.
+ * @param inArray The concurrent Array object (see `CX_ArrayCreateConcurrent()`).
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, the function returns the value false (which means that the process ran out of memory). In this case, the
+ * Array object is left untouched.
+ * @warning No thread may use the Array object while this function is executed.
+ */
 
-    if (inIndex != (inArray->count-1)) {
-        for(unsigned int i=inIndex; i<inArray->count-1; i++) {
-            inArray->elements[i] = inArray->elements[i+1];
+bool CX_ArrayConcurrentSeal(CX_Array inArray, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    struct CX_ArrayConcurrentStore *store = inArray->concurrent;
+    if (NULL == store) {
+        return true;
+    }
+    size_t published = _concurrentPublish(store);
+    size_t count = published;
+    void *element;
+    for (size_t i=published; i<store->reserved; i++) {
+        if (_concurrentIsReady(store, i, &element)) {
+            count++;
         }
     }
-    inArray->count -= 1;
-
-    if (inFree) {
-        if (NULL == inArray->elementDisposer) {
-            CX_StatusSetError(outStatus, 0,
-                              "The element should be freed, but no disposer dunction is specified for this array!");
-            return NULL;
+    if (count > SIZE_MAX - inArray->count || ! _grow(inArray, inArray->count + count)) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return false;
+    }
+    _concurrentCopy(store, published, inArray->elements + inArray->count);
+    inArray->count += published;
+    for (size_t i=published; i<store->reserved; i++) {
+        if (_concurrentIsReady(store, i, &element)) {
+            inArray->elements[inArray->count++] = element;
         }
-        inArray->elementDisposer(element);
-        element = NULL;
     }
+    _freeConcurrent(inArray, false);
+    return true;
+}
 
-    if (inArray->count > 0) {
-        inArray->elements = (void**)realloc(inArray->elements , (sizeof(void*) * inArray->count));
-        if (NULL == inArray->elements) {
-            CX_StatusSetError(outStatus, errno, "Cannot reallocate memory!");
-            return NULL;
-        }
-    } else {
-        free(inArray->elements);
-        inArray->elements = NULL;
+// ---------------------------------------------------------------------------------------------------------------------
+// Binary images
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a binary image file, and write its header.
+ * @param inPath The path to the file.
+ * @param inCount The number of elements.
+ * @param inElementSize The size of a value, or 0 for a records image.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the file, opened for writing.
+ * Otherwise, the function returns the value NULL.
+ */
+
+static FILE *_createImage(const char *inPath, size_t inCount, size_t inElementSize, CX_Status outStatus) {
+    FILE *file = fopen(inPath, "wb");
+    if (NULL == file) {
+        CX_StatusSetError(outStatus, errno, "Cannot open the file \"%s\" for writing: %m", inPath);
+        return NULL;
+    }
+    struct CX_ArrayImageHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CX_ARRAY_IMAGE_MAGIC, sizeof(header.magic));
+    header.version = CX_ARRAY_IMAGE_VERSION;
+    header.byteOrder = CX_ARRAY_IMAGE_BYTE_ORDER;
+    header.count = inCount;
+    header.elementSize = inElementSize;
+    if (1 != fwrite(&header, sizeof(header), 1, file)) {
+        CX_StatusSetError(outStatus, errno, "Cannot write to the file \"%s\": %m", inPath);
+        fclose(file);
+        remove(inPath);
+        return NULL;
     }
+    return file;
+}
 
-    return element;
+/**
+ * @brief Close a binary image file created by `_createImage()`.
+ * @param inFile The file.
+ * @param inWritten This flag tells whether all the data has been written (true), or not (false).
+ * @param inPath The path to the file.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false. In this case, the file is removed.
+ */
+
+static bool _closeImage(FILE *inFile, bool inWritten, const char *inPath, CX_Status outStatus) {
+    if (0 != fclose(inFile) || ! inWritten) {
+        CX_StatusSetError(outStatus, errno, "Cannot write to the file \"%s\": %m", inPath);
+        remove(inPath);
+        return false;
+    }
+    return true;
 }
 
 /**
- * @brief Search for elements within a given Array object.
- * @param inArray The Array object.
- * @param inKeep A pointer to a function used to decide whether an element should be kept or not.
- * The signature of this function is: `bool elementCompare (void *element)`.
- * `element`: this parameter will be assigned a pointer to an element of the array.
- * If the element must be kept, then the function must return the value true.
- * Otherwise, it returns the value false.
+ * @brief Load a binary image into memory, and check its header.
+ *
+ * If possible, the file is mapped (privately: the pages are only read from the disk when they are accessed, and the
+ * modifications are not written back to the file). Otherwise, it is read into a buffer.
+ * @param inPath The path to the file.
+ * @param outHeader Pointer to a memory location used to store the header of the image.
  * @param outStatus The Status object.
- * @return If elements are found, then the function returns a dynamic array that contains the elements.
+ * @return Upon successful completion the function returns the image.
  * Otherwise, the function returns the value NULL.
- * @warning The value NULL may be returned if the system ran out of memory. Thus, you should always examine the Status
- * object outStatus.
- * @warning Please keep in minf that the returned Array object has been **dynamically allocated**.
- * You should free it with the function `CX_ArrayDispose()`.
  */
-CX_Array CX_ArraySearch(CX_Array inArray, bool(*inKeep)(void*), CX_Status outStatus) {
-    CX_StatusReset(outStatus);
-    CX_ObjectManager m = CX_ObjectManagerCreate();
-    CX_Array found = CX_ArrayCreate(NULL, inArray->elementCloner);
-    if (NULL == found) {
-        CX_ObjectManagerDisposeOnError(m);
-        CX_StatusSetError(outStatus, 0, "Cannot allocate memory!");
+
+static struct CX_ArrayImage *_openImage(const char *inPath, struct CX_ArrayImageHeader *outHeader,
+        CX_Status outStatus) {
+    struct CX_ArrayImage *image = (struct CX_ArrayImage*)calloc(1, sizeof(struct CX_ArrayImage));
+    if (NULL == image) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
         return NULL;
     }
-    CX_OBJECT_MANAGER_ADD_RESULT(m, found, CX_ArrayDispose);
-
-    bool foundElement = false;
-    for (unsigned int i=0; i<inArray->count; i++) {
-        if (inKeep(inArray->elements[i])) {
-            foundElement = true;
-            if (NULL == CX_ArrayAdd(found, inArray->elements[i])) {
-                CX_ObjectManagerDisposeOnError(m);
-                CX_StatusSetError(outStatus, 0, "Cannot allocate memory!");
-                return NULL;
-            }
-        }
+#if CX_ARRAY_HAVE_MMAP
+    int fd = open(inPath, O_RDONLY);
+    if (fd < 0) {
+        CX_StatusSetError(outStatus, errno, "Cannot open the file \"%s\" for reading: %m", inPath);
+        free(image);
+        return NULL;
     }
-    if (! foundElement) {
-        CX_ObjectManagerDisposeAllOnSuccess(m);
+    struct stat info;
+    if (0 != fstat(fd, &info)) {
+        CX_StatusSetError(outStatus, errno, "Cannot get the size of the file \"%s\": %m", inPath);
+        close(fd);
+        free(image);
+        return NULL;
+    }
+    if ((uintmax_t)info.st_size < sizeof(struct CX_ArrayImageHeader) || (uintmax_t)info.st_size > SIZE_MAX) {
+        CX_StatusSetError(outStatus, 0, "The file \"%s\" is not an array image!", inPath);
+        close(fd);
+        free(image);
+        return NULL;
+    }
+    image->size = (size_t)info.st_size;
+    image->address = mmap(NULL, image->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == image->address) {
+        CX_StatusSetError(outStatus, errno, "Cannot map the file \"%s\": %m", inPath);
+        free(image);
+        return NULL;
+    }
+    image->mapped = true;
+#else
+    FILE *file = fopen(inPath, "rb");
+    if (NULL == file) {
+        CX_StatusSetError(outStatus, errno, "Cannot open the file \"%s\" for reading: %m", inPath);
+        free(image);
+        return NULL;
+    }
+    long size = 0 == fseek(file, 0, SEEK_END) ? ftell(file) : -1;
+    if (size < 0 || 0 != fseek(file, 0, SEEK_SET)) {
+        CX_StatusSetError(outStatus, errno, "Cannot get the size of the file \"%s\": %m", inPath);
+        fclose(file);
+        free(image);
+        return NULL;
+    }
+    if ((size_t)size < sizeof(struct CX_ArrayImageHeader)) {
+        CX_StatusSetError(outStatus, 0, "The file \"%s\" is not an array image!", inPath);
+        fclose(file);
+        free(image);
+        return NULL;
+    }
+    image->size = (size_t)size;
+    image->address = malloc(image->size);
+    if (NULL == image->address || image->size != fread(image->address, 1, image->size, file)) {
+        CX_StatusSetError(outStatus, errno, "Cannot read the %ld bytes of the file \"%s\": %m", size, inPath);
+        fclose(file);
+        _freeImage(image);
+        return NULL;
+    }
+    fclose(file);
+#endif
+    memcpy(outHeader, image->address, sizeof(struct CX_ArrayImageHeader));
+    if (0 != memcmp(outHeader->magic, CX_ARRAY_IMAGE_MAGIC, sizeof(outHeader->magic)) ||
+        CX_ARRAY_IMAGE_VERSION != outHeader->version || CX_ARRAY_IMAGE_BYTE_ORDER != outHeader->byteOrder) {
+        CX_StatusSetError(outStatus, 0, "The file \"%s\" is not an array image (or it has been written by an "
+                                        "incompatible host)!", inPath);
+        _freeImage(image);
         return NULL;
     }
+    return image;
+}
 
-    CX_ObjectManagerDispose(m);
-    return found;
+/**
+ * @brief Write the values of a given inline Array object into a binary image file.
+ *
+ * The image contains a header followed by the values, as they are stored in memory. It can be loaded by
+ * `CX_ArrayLoadInlineMapped()`.
+ * @param inArray The inline Array object (see `CX_ArrayCreateInline()`).
+ * @param inPath The path to the file. If the file exists, then it is overwritten.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false. In this case, the file is removed.
+ * @warning The values are written byte by byte: they must not contain pointers. Furthermore, the image can only be
+ * loaded on a host that has the same byte order, and the same representation of the values.
+ */
+
+bool CX_ArraySaveInline(CX_Array inArray, const char *inPath, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (0 == inArray->elementSize) {
+        CX_StatusSetError(outStatus, 0, "Only the values of an inline array can be saved as they are!");
+        return false;
+    }
+    FILE *file = _createImage(inPath, inArray->count, inArray->elementSize, outStatus);
+    if (NULL == file) {
+        // The status is set.
+        return false;
+    }
+    bool written = 0 == inArray->count ||
+                   inArray->count == fwrite(inArray->elements, inArray->elementSize, inArray->count, file);
+    return _closeImage(file, written, inPath, outStatus);
 }
 
 /**
- * @brief Insert an element at a given position within a given Array object.
+ * @brief Write the elements of a given Array object into a binary image file, as records of bytes.
+ *
+ * The image contains a header, a table that gives the offset and the length of each record, and the records. Each
+ * record contains the length of the data (64 bits), the data and a terminating zero. It can be loaded by
+ * `CX_ArrayLoadRecordsMapped()`.
  * @param inArray The Array object.
- * @param inElement A pointer to the element to insert.
- * Please note tat the inserted element is not cloned.
- * @param inIndex The position within the Array object.
+ * @param inPath The path to the file. If the file exists, then it is overwritten.
+ * @param inRecord Pointer to a function that returns the data of an element.
+ * The signature of this function is: `const void *record (void *element, size_t *length)`.
+ * `element`: this parameter will be assigned the element.
+ * `length`: this parameter will be assigned a pointer to a memory location used to store the length of the data.
+ * The function is called twice per element: it must return the same data each time.
  * @param outStatus The Status object.
- * @return Upon successful completion the function returns a pointer to the inserted element.
- * Otherwise, the function returns the value NULL. This may mean that the system ran out of memory or that the given
- * index is out of range.
- * @note Please note that the first element of the Array object is located at the index 0.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false. In this case, the file is removed.
  */
-void *CX_ArrayInsertAt(CX_Array inArray, void *inElement, unsigned int inIndex, CX_Status outStatus) {
+
+bool CX_ArraySaveRecords(CX_Array inArray, const char *inPath, const void*(*inRecord)(void*, size_t*),
+        CX_Status outStatus) {
+    static const char padding[8] = { 0 };
     CX_StatusReset(outStatus);
+    FILE *file = _createImage(inPath, inArray->count, 0, outStatus);
+    if (NULL == file) {
+        // The status is set.
+        return false;
+    }
+    size_t length;
+    struct CX_ArrayImageEntry entry;
+    entry.offset = sizeof(struct CX_ArrayImageHeader) + sizeof(entry) * (uint64_t)inArray->count;
+    bool written = true;
+    for (size_t i=0; written && i<inArray->count; i++) {
+        inRecord(CX_ARRAY_ELEMENT_AT(inArray, i), &length);
+        entry.length = length;
+        written = 1 == fwrite(&entry, sizeof(entry), 1, file);
+        entry.offset += CX_ARRAY_IMAGE_RECORD_SIZE(length);
+    }
+    for (size_t i=0; written && i<inArray->count; i++) {
+        const void *data = inRecord(CX_ARRAY_ELEMENT_AT(inArray, i), &length);
+        uint64_t prefix = length;
+        written = 1 == fwrite(&prefix, sizeof(prefix), 1, file) &&
+                  (0 == length || 1 == fwrite(data, length, 1, file)) &&
+                  1 == fwrite(padding, CX_ARRAY_IMAGE_RECORD_SIZE(length) - sizeof(prefix) - length, 1, file);
+    }
+    return _closeImage(file, written, inPath, outStatus);
+}
 
-    if (inIndex >= inArray->count) {
-        CX_StatusSetError(outStatus, 0, "Invalid index %u. The array only contains %u elements!", inIndex,
-                          inArray->count);
+/**
+ * @brief Load an inline Array object from a binary image file written by `CX_ArraySaveInline()`.
+ *
+ * The file is mapped, and the values are used in place: they are neither parsed nor copied. Thus, loading the Array
+ * object costs O(1), and the pages of the file are only read when the values are accessed.
+ * @param inPath The path to the file.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a new inline Array object, which has no disposer.
+ * Otherwise, the function returns the value NULL (which means that the file cannot be read, or that it is not a valid
+ * inline image).
+ * @warning Please keep in mind that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`.
+ * @note The Array object can be modified: the modified pages are copied in memory, and the file is left untouched.
+ * When the Array object grows, its values are moved into a buffer allocated for it.
+ */
+
+CX_Array CX_ArrayLoadInlineMapped(const char *inPath, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    struct CX_ArrayImageHeader header;
+    struct CX_ArrayImage *image = _openImage(inPath, &header, outStatus);
+    if (NULL == image) {
+        // The status is set.
         return NULL;
     }
-
-    inArray->count += 1;
-    inArray->elements = (void**)realloc(inArray->elements, sizeof(void*) * inArray->count);
-    if (NULL == inArray->elements) {
-        CX_StatusSetError(outStatus, 0, "Cannot allocate memory!");
+    size_t available = image->size - sizeof(header);
+    if (0 == header.elementSize || (uint64_t)(size_t)header.elementSize != header.elementSize ||
+        header.count > available / header.elementSize) {
+        CX_StatusSetError(outStatus, 0, "The file \"%s\" is not a valid inline array image!", inPath);
+        _freeImage(image);
         return NULL;
     }
-
-    for (unsigned int i=inArray->count-1; i>inIndex; i--) {
-        inArray->elements[i] = inArray->elements[i-1];
+    CX_Array array = CX_ArrayCreateInline((size_t)header.elementSize, NULL);
+    if (NULL == array) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        _freeImage(image);
+        return NULL;
     }
-    inArray->elements[inIndex] = inElement;
-
-    return inElement;
+    array->image = image;
+    if (header.count > 0) {
+        array->elements = (void**)((char*)image->address + sizeof(header));
+        array->count = (size_t)header.count;
+        array->capacity = (size_t)header.count;
+    }
+    return array;
 }
 
 /**
- * @brief Replace an element by another one in a given Array object, at a given position.
- * @param inArray The Array object.
- * @param inElement The replacement element.
- * Please note tat the element that is replaced is not cloned.
- * @param inIndex The position, within the Array object, of the element to replace.
+ * @brief Load an Array object from a binary image file written by `CX_ArraySaveRecords()`.
+ *
+ * The file is mapped, and the data of the records is used in place: it is not copied. However, loading the image costs
+ * O(N), where N is the number of records: the function reads the whole table of the image, checks each entry (and the
+ * terminating zero of each record), and allocates one descriptor per record.
+ * @param inPath The path to the file.
+ * @param elementDisposer Pointer to a function used to free an element of the clones of the Array object (see
+ * `CX_ArrayDup()`). It is never called for the elements of the returned Array object, since they belong to the image.
+ * @param elementCloner Pointer to a function used to clone an element of the Array object (see `CX_ArrayCreate()`).
  * @param outStatus The Status object.
- * @return Upon successful completion, the function returns the value true.
- * Otherwise, the function returns the value false. In this case, you should examine the Status object:
- * A failure can be the result of an invalid index or an insufficient memory.
+ * @return Upon successful completion the function returns a new Array object. Each element is a pointer to a
+ * `struct CX_ArrayRecordType` (which first field is the address of the data of the record).
+ * Otherwise, the function returns the value NULL (which means that the file cannot be read, or that it is not a valid
+ * records image).
+ * @warning Please keep in mind that the returned Array object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayDispose()`.
+ * @warning The elements of the returned Array object must not be freed, nor reallocated. Elements can be added to the
+ * Array object, but they are never disposed by the Array object.
  */
 
-bool CX_ArrayReplaceAt(CX_Array inArray, void *inElement, unsigned int inIndex, CX_Status outStatus) {
+CX_Array CX_ArrayLoadRecordsMapped(const char *inPath, void(*elementDisposer)(void*),
+        void*(*elementCloner)(void*, CX_Status), CX_Status outStatus) {
     CX_StatusReset(outStatus);
-    if (inIndex >= inArray->count) {
-        CX_StatusSetError(outStatus, 0, "Invalid index %u. The array only contains %u elements!", inIndex,
-                          inArray->count);
-        return false;
+    struct CX_ArrayImageHeader header;
+    struct CX_ArrayImage *image = _openImage(inPath, &header, outStatus);
+    if (NULL == image) {
+        // The status is set.
+        return NULL;
     }
-
-    if (NULL != inArray->elementDisposer) {
-        void *actualElement = CX_ArrayGetElementAt(inArray, inIndex);
-        inArray->elementDisposer(actualElement);
+    char *address = (char*)image->address;
+    size_t available = image->size - sizeof(header);
+    if (0 != header.elementSize || header.count > available / sizeof(struct CX_ArrayImageEntry) ||
+        (header.count > 0 && 0 != address[image->size - 1])) {
+        CX_StatusSetError(outStatus, 0, "The file \"%s\" is not a valid records image!", inPath);
+        _freeImage(image);
+        return NULL;
     }
-    inArray->elements[inIndex] = inElement;
-    return true;
+    size_t count = (size_t)header.count;
+    size_t first = sizeof(header) + sizeof(struct CX_ArrayImageEntry) * count;
+    CX_Array array = CX_ArrayCreate(&_imageDisposer, elementCloner);
+    if (count > 0) {
+        image->records = (struct CX_ArrayRecordType*)malloc(sizeof(struct CX_ArrayRecordType) * count);
+    }
+    if (NULL == array || (count > 0 && NULL == image->records) || ! _setCapacity(array, count)) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        if (NULL != array) {
+            CX_ArrayDispose(array);
+        }
+        _freeImage(image);
+        return NULL;
+    }
+    for (size_t i=0; i<count; i++) {
+        struct CX_ArrayImageEntry entry;
+        memcpy(&entry, address + sizeof(header) + sizeof(entry) * i, sizeof(entry));
+        // The record must lie within the image, and its data must be terminated by a zero.
+        if (entry.offset < first || 0 != entry.offset % sizeof(uint64_t) ||
+            entry.offset > image->size - sizeof(uint64_t) - 1 ||
+            entry.length > image->size - sizeof(uint64_t) - 1 - entry.offset ||
+            0 != address[entry.offset + sizeof(uint64_t) + entry.length]) {
+            CX_StatusSetError(outStatus, 0, "The file \"%s\" is not a valid records image!", inPath);
+            CX_ArrayDispose(array);
+            _freeImage(image);
+            return NULL;
+        }
+        image->records[i].data = address + entry.offset + sizeof(uint64_t);
+        image->records[i].length = (size_t)entry.length;
+        image->records[i].capacity = 0;
+        array->elements[i] = &image->records[i];
+    }
+    array->count = count;
+    image->elementDisposer = elementDisposer;
+    array->image = image;
+    return array;
 }
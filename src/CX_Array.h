@@ -7,14 +7,81 @@
 
 CX_Array CX_ArrayCreate(void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status));
 void CX_ArrayDispose(CX_Array inArray);
-unsigned int CX_ArrayGetCount(CX_Array inArray);
+size_t CX_ArrayGetCount(CX_Array inArray);
 void **CX_ArrayGetElements(CX_Array inArray);
 CX_Array CX_ArrayDup(CX_Array inArray, CX_Status outStatus);
-void *CX_ArrayGetElementAt(CX_Array inArray, unsigned int inIndex);
+void *CX_ArrayGetElementAt(CX_Array inArray, size_t inIndex);
 void *CX_ArrayAdd(CX_Array inArray, void *inElement);
-void *CX_ArrayRemove(CX_Array inArray, unsigned int inIndex, bool inFree, CX_Status outStatus);
-void *CX_ArrayInsertAt(CX_Array inArray, void *inElement, unsigned int inIndex, CX_Status outStatus);
-bool CX_ArrayReplaceAt(CX_Array inArray, void *inElement, unsigned int inIndex, CX_Status outStatus);
+void *CX_ArrayRemove(CX_Array inArray, size_t inIndex, bool inFree, CX_Status outStatus);
+void *CX_ArrayInsertAt(CX_Array inArray, void *inElement, size_t inIndex, CX_Status outStatus);
+bool CX_ArrayReplaceAt(CX_Array inArray, void *inElement, size_t inIndex, CX_Status outStatus);
+void *CX_ArraySwapRemove(CX_Array inArray, size_t inIndex, bool inFree, CX_Status outStatus);
+bool CX_ArraySwapRemoveValue(CX_Array inArray, size_t inIndex, void *outValue, CX_Status outStatus);
+size_t CX_ArrayRemoveIf(CX_Array inArray, bool(*inRemove)(void*, void*), void *inContext, bool inFree,
+        CX_Status outStatus);
 CX_Array CX_ArraySearch(CX_Array inArray, bool(*inKeep)(void*), CX_Status outStatus);
+size_t CX_ArrayGetCapacity(CX_Array inArray);
+bool CX_ArrayReserve(CX_Array inArray, size_t inCapacity, CX_Status outStatus);
+bool CX_ArrayShrinkToFit(CX_Array inArray, CX_Status outStatus);
+CX_Array CX_ArrayCreateInline(size_t inElementSize, void(*elementDisposer)(void*));
+size_t CX_ArrayGetElementSize(CX_Array inArray);
+void *CX_ArrayGetValues(CX_Array inArray);
+void *CX_ArrayGetValueAt(CX_Array inArray, size_t inIndex);
+void *CX_ArrayAddValue(CX_Array inArray, const void *inValue);
+void *CX_ArrayInsertValueAt(CX_Array inArray, const void *inValue, size_t inIndex, CX_Status outStatus);
+bool CX_ArrayRemoveValue(CX_Array inArray, size_t inIndex, void *outValue, CX_Status outStatus);
+bool CX_ArrayReplaceValueAt(CX_Array inArray, const void *inValue, size_t inIndex, CX_Status outStatus);
+CX_Array CX_ArraySearchValues(CX_Array inArray, bool(*inKeep)(void*), CX_Status outStatus);
+bool CX_ArrayAddMany(CX_Array inArray, const void *inElements, size_t inCount, CX_Status outStatus);
+bool CX_ArrayInsertRange(CX_Array inArray, const void *inElements, size_t inCount, size_t inIndex,
+        CX_Status outStatus);
+bool CX_ArrayRemoveRange(CX_Array inArray, size_t inIndex, size_t inCount, bool inFree,
+        CX_Status outStatus);
+bool CX_ArrayTruncate(CX_Array inArray, size_t inCount);
+CX_Array CX_ArraySearchEx(CX_Array inArray, bool(*inKeep)(void*, void*), void *inContext, unsigned int inThreads,
+        CX_Status outStatus);
+bool CX_ArraySort(CX_Array inArray, int(*inCompare)(void*, void*, void*), void *inContext);
+bool CX_ArraySortParallel(CX_Array inArray, int(*inCompare)(void*, void*, void*), void *inContext,
+        unsigned int inThreads, CX_Status outStatus);
+size_t CX_ArrayLowerBound(CX_Array inArray, void *inKey, int(*inCompare)(void*, void*, void*), void *inContext);
+void *CX_ArrayBinarySearch(CX_Array inArray, void *inKey, int(*inCompare)(void*, void*, void*), void *inContext,
+        size_t *outIndex);
+void *CX_ArrayInsertSorted(CX_Array inArray, void *inElement, int(*inCompare)(void*, void*, void*), void *inContext,
+        CX_Status outStatus);
+size_t CX_ArraySearchIndices(CX_Array inArray, bool(*inKeep)(void*, void*), void *inContext,
+        size_t *outIndices, size_t inMaxIndices);
+size_t CX_ArraySearchBitmap(CX_Array inArray, bool(*inKeep)(void*, void*), void *inContext,
+        unsigned char *outBitmap);
+void CX_ArrayFilterIteratorInit(CX_ArrayFilterIterator *outIterator, CX_Array inArray, bool(*inKeep)(void*, void*),
+        void *inContext);
+void CX_ArraySetCopyOnWrite(CX_Array inArray, bool inEnable);
+bool CX_ArrayIsShared(CX_Array inArray);
+CX_Array CX_ArrayDupParallel(CX_Array inArray, unsigned int inThreads, CX_Status outStatus);
+CX_Array CX_ArrayCreateDeque(void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status));
+void *CX_ArrayPushFront(CX_Array inArray, void *inElement);
+CX_Array CX_ArrayCreateArena();
+void *CX_ArrayAllocElement(CX_Array inArray, size_t inSize);
+void CX_ArraySetHugePageThreshold(CX_Array inArray, size_t inThreshold);
+bool CX_ArrayForEachParallel(CX_Array inArray, void(*inFunction)(void*, size_t, void*), void *inContext,
+        size_t inGrain, unsigned int inThreads, CX_Status outStatus);
+CX_Array CX_ArrayMapParallel(CX_Array inArray, void*(*inMap)(void*, void*, CX_Status), void *inContext,
+        void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status), size_t inGrain,
+        unsigned int inThreads, CX_Status outStatus);
+bool CX_ArrayReduceParallel(CX_Array inArray, void *ioAccumulator, size_t inAccumulatorSize,
+        void(*inAccumulate)(void*, void*, void*), void(*inCombine)(void*, void*, void*), void *inContext,
+        size_t inGrain, unsigned int inThreads, CX_Status outStatus);
+CX_Array CX_ArrayCreateConcurrent(void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status));
+void *CX_ArrayConcurrentAdd(CX_Array inArray, void *inElement);
+size_t CX_ArrayConcurrentGetCount(CX_Array inArray);
+void *CX_ArrayConcurrentGetAt(CX_Array inArray, size_t inIndex);
+CX_Array CX_ArrayConcurrentSnapshot(CX_Array inArray, CX_Status outStatus);
+bool CX_ArrayConcurrentSeal(CX_Array inArray, CX_Status outStatus);
+bool CX_ArraySaveInline(CX_Array inArray, const char *inPath, CX_Status outStatus);
+bool CX_ArraySaveRecords(CX_Array inArray, const char *inPath, const void*(*inRecord)(void*, size_t*),
+        CX_Status outStatus);
+CX_Array CX_ArrayLoadInlineMapped(const char *inPath, CX_Status outStatus);
+CX_Array CX_ArrayLoadRecordsMapped(const char *inPath, void(*elementDisposer)(void*),
+        void*(*elementCloner)(void*, CX_Status), CX_Status outStatus);
+bool CX_ArrayFilterIteratorNext(CX_ArrayFilterIterator *inIterator, void **outElement, size_t *outIndex);
 
 #endif //CX_LIB_CX_ARRAY_H
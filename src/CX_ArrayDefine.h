@@ -0,0 +1,302 @@
+/**
+ * @file
+ *
+ * @brief This file defines the macro `CX_ARRAY_DEFINE()`, which generates a dynamic array specialized for a given type.
+ *
+ * Unlike the Array object (see `CX_Array.h`), which manipulates elements through `void*` pointers and function
+ * pointers, a specialized array stores its values by value, in a contiguous buffer of the given type, and all its
+ * functions are `static inline`. Thus, the compiler can inline (and vectorize) the loops that access the values.
+ *
+ * @example
+ * CX_ARRAY_DEFINE(IntArray, int)
+ *
+ * IntArray array = IntArrayCreate();
+ * IntArrayAdd(array, 10);
+ * IntArrayAdd(array, 5);
+ * IntArraySort(array, &compareInt);
+ * for (size_t i=0; i<IntArrayGetCount(array); i++) {
+ *     printf("%d\n", IntArrayAt(array, i));
+ * }
+ * IntArrayDispose(array);
+ */
+
+#ifndef CX_LIB_CX_ARRAYDEFINE_H
+#define CX_LIB_CX_ARRAYDEFINE_H
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdint.h>
+
+/*! \brief Number of values allocated the first time a value is added to an empty specialized array.
+ */
+
+#define CX_ARRAY_DEFINE_INITIAL_CAPACITY 8
+
+/*! \brief Ranges that contain less values than this number are sorted by insertion.
+ */
+
+#define CX_ARRAY_DEFINE_INSERTION_THRESHOLD 16
+
+/**
+ * @brief Define a dynamic array of values of a given type.
+ *
+ * The macro defines the type `Name` (a pointer to a `struct NameType`) and the following functions:
+ *
+ * - `Name NameCreate()`: create an empty array. The function returns the value NULL if the process ran out of memory.
+ *   The returned array must be freed with `NameDispose()`.
+ * - `void NameDispose(Name inArray)`: free the array. Please note that the values are not disposed: if they reference
+ *   resources, then these resources must be released by the caller.
+ * - `size_t NameGetCount(Name inArray)`: return the number of values.
+ * - `size_t NameGetCapacity(Name inArray)`: return the number of values the array can hold without reallocating
+ *   memory.
+ * - `T *NameGetValues(Name inArray)`: return the buffer that contains the values. It becomes invalid as soon as a value
+ *   is added to the array.
+ * - `bool NameReserve(Name inArray, size_t inCapacity)`: make sure that the array can hold `inCapacity` values.
+ * - `bool NameAdd(Name inArray, T inValue)`: add a value at the end of the array.
+ * - `bool NameInsertAt(Name inArray, T inValue, size_t inIndex)`: insert a value at a given position. The
+ *   position may be equal to the number of values.
+ * - `T NameAt(Name inArray, size_t inIndex)`: return the value at a given position. The position is not checked.
+ * - `T *NameGetAt(Name inArray, size_t inIndex)`: return a pointer to the value at a given position, or the value
+ *   NULL if the position is not valid.
+ * - `void NameSet(Name inArray, size_t inIndex, T inValue)`: replace the value at a given position. The position
+ *   is not checked.
+ * - `bool NameRemove(Name inArray, size_t inIndex, T *outValue)`: remove the value at a given position. If
+ *   `outValue` is not NULL, then the removed value is copied to this location.
+ * - `void NameClear(Name inArray)`: remove all the values (the memory is not released).
+ * - `void NameSort(Name inArray, int(*inCompare)(const T*, const T*))`: sort the values (O(N.log(N)), not stable).
+ * - `size_t NameLowerBound(Name inArray, const T *inKey, int(*inCompare)(const T*, const T*))`: return the
+ *   position of the first value that is not lower than a given key, within a sorted array.
+ *
+ * The functions that return a boolean return the value false if the process ran out of memory, or if the given
+ * position is not valid. In this case, the array is left untouched.
+ * The macro also defines helper functions, which names start with `NameInternal`. They should not be called directly.
+ * @param Name The name of the type to define. It is also used as the prefix of the names of the functions.
+ * @param T The type of the values.
+ * @note This macro should be used at file scope. Since all the generated functions are `static`, it can be used in
+ * several translation units.
+ */
+
+#define CX_ARRAY_DEFINE(Name, T) \
+\
+typedef struct Name##Type { \
+    T *values; \
+    size_t count; \
+    size_t capacity; \
+} *Name; \
+\
+static inline Name Name##Create(void) { \
+    Name array = (Name)malloc(sizeof(struct Name##Type)); \
+    if (NULL == array) { \
+        return NULL; \
+    } \
+    array->values = NULL; \
+    array->count = 0; \
+    array->capacity = 0; \
+    return array; \
+} \
+\
+static inline void Name##Dispose(Name inArray) { \
+    free(inArray->values); \
+    free(inArray); \
+} \
+\
+static inline size_t Name##GetCount(Name inArray) { \
+    return inArray->count; \
+} \
+\
+static inline size_t Name##GetCapacity(Name inArray) { \
+    return inArray->capacity; \
+} \
+\
+static inline T *Name##GetValues(Name inArray) { \
+    return inArray->values; \
+} \
+\
+static inline bool Name##Reserve(Name inArray, size_t inCapacity) { \
+    if (inCapacity <= inArray->capacity) { \
+        return true; \
+    } \
+    if (inCapacity > SIZE_MAX / sizeof(T)) { \
+        return false; \
+    } \
+    T *values = (T*)realloc(inArray->values, sizeof(T) * inCapacity); \
+    if (NULL == values) { \
+        return false; \
+    } \
+    inArray->values = values; \
+    inArray->capacity = inCapacity; \
+    return true; \
+} \
+\
+static inline bool Name##InternalGrow(Name inArray) { \
+    size_t maxCapacity = SIZE_MAX / sizeof(T); \
+    if (inArray->count >= maxCapacity) { \
+        return false; \
+    } \
+    size_t capacity = inArray->capacity < CX_ARRAY_DEFINE_INITIAL_CAPACITY ? \
+            CX_ARRAY_DEFINE_INITIAL_CAPACITY : inArray->capacity; \
+    while (capacity <= inArray->count) { \
+        capacity = capacity > maxCapacity / 2 ? maxCapacity : capacity * 2; \
+    } \
+    return Name##Reserve(inArray, capacity); \
+} \
+\
+static inline bool Name##Add(Name inArray, T inValue) { \
+    if (inArray->count == inArray->capacity && ! Name##InternalGrow(inArray)) { \
+        return false; \
+    } \
+    inArray->values[inArray->count++] = inValue; \
+    return true; \
+} \
+\
+static inline bool Name##InsertAt(Name inArray, T inValue, size_t inIndex) { \
+    if (inIndex > inArray->count) { \
+        return false; \
+    } \
+    if (inArray->count == inArray->capacity && ! Name##InternalGrow(inArray)) { \
+        return false; \
+    } \
+    memmove(inArray->values + inIndex + 1, inArray->values + inIndex, sizeof(T) * (inArray->count - inIndex)); \
+    inArray->values[inIndex] = inValue; \
+    inArray->count += 1; \
+    return true; \
+} \
+\
+static inline T Name##At(Name inArray, size_t inIndex) { \
+    return inArray->values[inIndex]; \
+} \
+\
+static inline T *Name##GetAt(Name inArray, size_t inIndex) { \
+    return inIndex < inArray->count ? inArray->values + inIndex : NULL; \
+} \
+\
+static inline void Name##Set(Name inArray, size_t inIndex, T inValue) { \
+    inArray->values[inIndex] = inValue; \
+} \
+\
+static inline bool Name##Remove(Name inArray, size_t inIndex, T *outValue) { \
+    if (inIndex >= inArray->count) { \
+        return false; \
+    } \
+    if (NULL != outValue) { \
+        *outValue = inArray->values[inIndex]; \
+    } \
+    memmove(inArray->values + inIndex, inArray->values + inIndex + 1, \
+            sizeof(T) * (inArray->count - inIndex - 1)); \
+    inArray->count -= 1; \
+    return true; \
+} \
+\
+static inline void Name##Clear(Name inArray) { \
+    inArray->count = 0; \
+} \
+\
+static inline void Name##InternalSiftDown(T *inValues, size_t inRoot, size_t inCount, \
+        int(*inCompare)(const T*, const T*)) { \
+    T value = inValues[inRoot]; \
+    size_t child; \
+    while ((child = 2 * inRoot + 1) < inCount) { \
+        if (child + 1 < inCount && inCompare(inValues + child, inValues + child + 1) < 0) { \
+            child++; \
+        } \
+        if (inCompare(&value, inValues + child) >= 0) { \
+            break; \
+        } \
+        inValues[inRoot] = inValues[child]; \
+        inRoot = child; \
+    } \
+    inValues[inRoot] = value; \
+} \
+\
+static inline void Name##InternalHeapSort(T *inValues, size_t inCount, int(*inCompare)(const T*, const T*)) { \
+    for (size_t i = inCount / 2; i > 0; i--) { \
+        Name##InternalSiftDown(inValues, i - 1, inCount, inCompare); \
+    } \
+    for (size_t i = inCount; i > 1; i--) { \
+        T value = inValues[0]; \
+        inValues[0] = inValues[i - 1]; \
+        inValues[i - 1] = value; \
+        Name##InternalSiftDown(inValues, 0, i - 1, inCompare); \
+    } \
+} \
+\
+static inline void Name##InternalIntroSort(T *inValues, size_t inCount, size_t inDepth, \
+        int(*inCompare)(const T*, const T*)) { \
+    while (inCount > CX_ARRAY_DEFINE_INSERTION_THRESHOLD) { \
+        if (0 == inDepth--) { \
+            Name##InternalHeapSort(inValues, inCount, inCompare); \
+            return; \
+        } \
+        /* Median of three: values[0] <= values[middle] <= values[last]. */ \
+        T swap; \
+        size_t middle = inCount / 2, last = inCount - 1; \
+        if (inCompare(inValues + middle, inValues) < 0) { \
+            swap = inValues[middle]; inValues[middle] = inValues[0]; inValues[0] = swap; \
+        } \
+        if (inCompare(inValues + last, inValues + middle) < 0) { \
+            swap = inValues[last]; inValues[last] = inValues[middle]; inValues[middle] = swap; \
+            if (inCompare(inValues + middle, inValues) < 0) { \
+                swap = inValues[middle]; inValues[middle] = inValues[0]; inValues[0] = swap; \
+            } \
+        } \
+        T pivot = inValues[middle]; \
+        size_t i = 0, j = last; \
+        for (;;) { \
+            while (inCompare(inValues + i, &pivot) < 0) { \
+                i++; \
+            } \
+            while (inCompare(&pivot, inValues + j) < 0) { \
+                j--; \
+            } \
+            if (i >= j) { \
+                break; \
+            } \
+            swap = inValues[i]; inValues[i] = inValues[j]; inValues[j] = swap; \
+            i++; \
+            j--; \
+        } \
+        /* Recurse into the smaller part, and loop over the larger one. */ \
+        if (j + 1 < inCount - j - 1) { \
+            Name##InternalIntroSort(inValues, j + 1, inDepth, inCompare); \
+            inValues += j + 1; \
+            inCount -= j + 1; \
+        } else { \
+            Name##InternalIntroSort(inValues + j + 1, inCount - j - 1, inDepth, inCompare); \
+            inCount = j + 1; \
+        } \
+    } \
+    for (size_t i = 1; i < inCount; i++) { \
+        T value = inValues[i]; \
+        size_t j = i; \
+        while (j > 0 && inCompare(&value, inValues + j - 1) < 0) { \
+            inValues[j] = inValues[j - 1]; \
+            j--; \
+        } \
+        inValues[j] = value; \
+    } \
+} \
+\
+static inline void Name##Sort(Name inArray, int(*inCompare)(const T*, const T*)) { \
+    size_t depth = 0; \
+    for (size_t n = inArray->count; n > 1; n >>= 1) { \
+        depth += 2; \
+    } \
+    Name##InternalIntroSort(inArray->values, inArray->count, depth, inCompare); \
+} \
+\
+static inline size_t Name##LowerBound(Name inArray, const T *inKey, int(*inCompare)(const T*, const T*)) { \
+    size_t first = 0, count = inArray->count; \
+    while (count > 0) { \
+        size_t half = count / 2; \
+        if (inCompare(inArray->values + first + half, inKey) < 0) { \
+            first += half + 1; \
+            count -= half + 1; \
+        } else { \
+            count = half; \
+        } \
+    } \
+    return first; \
+}
+
+#endif //CX_LIB_CX_ARRAYDEFINE_H
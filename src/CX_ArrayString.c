@@ -37,6 +37,18 @@ static void* _stringCloner(void *inString, CX_Status outStatus) {
     return (void*)newString;
 }
 
+/**
+ * @brief Return the data of an element of an ArrayString object, as it is written into a binary image.
+ * @param inString The String object.
+ * @param outLength Pointer to a memory location used to store the length of the string.
+ * @return The function returns the zero terminated string of characters.
+ */
+
+static const void *_stringRecord(void *inString, size_t *outLength) {
+    *outLength = CX_StringLength((CX_String) inString);
+    return *(CX_String) inString;
+}
+
 /**
  * @brief Create an ArrayString object.
  * @param inString Optional string. If this value is not NULL, then the ArrayString object will be initialized with this
@@ -72,7 +84,7 @@ void CX_ArrayStringDispose(CX_ArrayString inArray) {
  * @return The function returns the number of String object within a given ArrayString object.
  */
 
-unsigned long CX_ArrayStringGetCount(CX_ArrayString inArray) {
+size_t CX_ArrayStringGetCount(CX_ArrayString inArray) {
     return CX_ArrayGetCount((CX_Array) inArray);
 }
 
@@ -101,6 +113,21 @@ CX_ArrayString CX_ArrayStringDup(CX_ArrayString inArray, CX_Status outStatus) {
     return (CX_ArrayString) CX_ArrayDup((CX_Array) inArray, outStatus);
 }
 
+/**
+ * @brief Make a copy of a given list of ArrayString object, using several threads to copy the strings.
+ * @param inArray The ArrayString object to copy.
+ * @param inThreads The maximum number of threads to use. The value 0 means "as many threads as online processors".
+ * @param outStatus The Status object.
+ * @return Upon successful completion, the function returns a copy of the given ArrayString object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ * @warning Please keep in mind that the returned object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayStringDispose()`.
+ * @see `CX_ArrayDupParallel()`
+ */
+CX_ArrayString CX_ArrayStringDupParallel(CX_ArrayString inArray, unsigned int inThreads, CX_Status outStatus) {
+    return (CX_ArrayString) CX_ArrayDupParallel((CX_Array) inArray, inThreads, outStatus);
+}
+
 /**
  * @brief Add a string at the end of a given ArrayString object.
  *
@@ -135,7 +162,7 @@ bool CX_ArrayStringAddCloneChar(CX_ArrayString inArray, char* inString) {
 
 bool CX_ArrayStringReplaceAtCloneChar(
         CX_ArrayString inArray,
-        unsigned int inIndex,
+        size_t inIndex,
         char* inString,
         CX_Status outStatus) {
     CX_StatusReset(outStatus);
@@ -158,7 +185,7 @@ bool CX_ArrayStringReplaceAtCloneChar(
  * You should free it with the function `CX_ArrayStringDispose()`.
  */
 
-CX_String CX_ArrayStringGetStringAt(CX_ArrayString inArray, unsigned long inIndex) {
+CX_String CX_ArrayStringGetStringAt(CX_ArrayString inArray, size_t inIndex) {
     return (CX_String) CX_ArrayGetElementAt(inArray, inIndex);
 }
 
@@ -187,8 +214,8 @@ CX_String CX_ArrayStringJoinChar(CX_ArrayString inArray, char *inGlue) {
         return NULL;
     }
 
-    unsigned long count = CX_ArrayStringGetCount(inArray);
-    for (int i=0; i < count; i++) {
+    size_t count = CX_ArrayStringGetCount(inArray);
+    for (size_t i=0; i < count; i++) {
         CX_String string = CX_ArrayStringGetStringAt(inArray, i);
         if (!CX_StringAppend(result, string)) {
             return NULL;
@@ -212,7 +239,7 @@ CX_String CX_ArrayStringJoinChar(CX_ArrayString inArray, char *inGlue) {
 
 bool CX_ArrayStringPrependChar(CX_ArrayString inArray, char *inPrefix) {
     CX_Status status = CX_StatusCreate();
-    for (int i=0; i < CX_ArrayStringGetCount(inArray); i++) {
+    for (size_t i=0; i < CX_ArrayStringGetCount(inArray); i++) {
         CX_String string = CX_ArrayStringGetStringAt(inArray, i);
         if (!CX_StringPrependChar(string, inPrefix)) {
             return false;
@@ -232,7 +259,7 @@ bool CX_ArrayStringPrependChar(CX_ArrayString inArray, char *inPrefix) {
 
 bool CX_ArrayStringAppendChar(CX_ArrayString inArray, char *inPrefix) {
     CX_Status status = CX_StatusCreate();
-    for (int i=0; i < CX_ArrayStringGetCount(inArray); i++) {
+    for (size_t i=0; i < CX_ArrayStringGetCount(inArray); i++) {
         CX_String string = CX_ArrayStringGetStringAt(inArray, i);
         if (!CX_StringAppendChar(string, inPrefix)) {
             return false;
@@ -241,3 +268,40 @@ bool CX_ArrayStringAppendChar(CX_ArrayString inArray, char *inPrefix) {
     CX_StatusDispose(status);
     return true;
 }
+
+/**
+ * @brief Write the strings of a given ArrayString object into a binary image file.
+ *
+ * Each string is written with its length, and it is indexed by a table of offsets. The file can be loaded by
+ * `CX_ArrayStringLoadMapped()`.
+ * @param inArray The ArrayString object.
+ * @param inPath The path to the file. If the file exists, then it is overwritten.
+ * @param outStatus The Status object.
+ * @return Upon successful completion, the function returns the value true.
+ * Otherwise, it returns the value false.
+ * @see `CX_ArraySaveRecords()`
+ */
+bool CX_ArrayStringSave(CX_ArrayString inArray, const char *inPath, CX_Status outStatus) {
+    return CX_ArraySaveRecords((CX_Array) inArray, inPath, &_stringRecord, outStatus);
+}
+
+/**
+ * @brief Load an ArrayString object from a binary image file written by `CX_ArrayStringSave()`.
+ *
+ * The file is mapped, and the strings are used in place: they are not copied. However, loading the image costs O(N),
+ * where N is the number of strings, and it reads the whole file: the terminating zero of each string is checked (see
+ * `CX_ArrayLoadRecordsMapped()`).
+ * @param inPath The path to the file.
+ * @param outStatus The Status object.
+ * @return Upon successful completion, the function returns a new ArrayString object.
+ * Otherwise, it returns the value NULL (which means that the file cannot be read, or that it is not a valid image).
+ * @warning Please keep in mind that the returned object has been **dynamically allocated**.
+ * You should free it with the function `CX_ArrayStringDispose()`.
+ * @warning The strings of the returned ArrayString object belong to the image: they must not be modified (see
+ * `CX_ArrayStringPrependChar()` and `CX_ArrayStringAppendChar()`), replaced or removed, and no string should be added.
+ * A clone of the ArrayString object (see `CX_ArrayStringDup()`) can be modified without restriction.
+ * @see `CX_ArrayLoadRecordsMapped()`
+ */
+CX_ArrayString CX_ArrayStringLoadMapped(const char *inPath, CX_Status outStatus) {
+    return (CX_ArrayString) CX_ArrayLoadRecordsMapped(inPath, &_stringDisposer, &_stringCloner, outStatus);
+}
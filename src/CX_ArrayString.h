@@ -8,14 +8,17 @@
 
 CX_ArrayString CX_ArrayStringCreate(CX_String inString);
 void CX_ArrayStringDispose(CX_ArrayString inArray);
-unsigned long CX_ArrayStringGetCount(CX_ArrayString inArray);
+size_t CX_ArrayStringGetCount(CX_ArrayString inArray);
 CX_String *CX_ArrayStringGetStrings(CX_ArrayString inArray);
 CX_ArrayString CX_ArrayStringDup(CX_ArrayString inArray, CX_Status outStatus);
+CX_ArrayString CX_ArrayStringDupParallel(CX_ArrayString inArray, unsigned int inThreads, CX_Status outStatus);
 bool CX_ArrayStringAddCloneChar(CX_ArrayString inArray, char* inString);
-bool CX_ArrayStringReplaceAtCloneChar(CX_ArrayString inArray, unsigned int inIndex, char* inString, CX_Status outStatus);
-CX_String CX_ArrayStringGetStringAt(CX_ArrayString inArray, unsigned long inIndex);
+bool CX_ArrayStringReplaceAtCloneChar(CX_ArrayString inArray, size_t inIndex, char* inString, CX_Status outStatus);
+CX_String CX_ArrayStringGetStringAt(CX_ArrayString inArray, size_t inIndex);
 CX_String CX_ArrayStringJoinChar(CX_ArrayString inArray, char *inGlue);
 bool CX_ArrayStringPrependChar(CX_ArrayString inArray, char *inPrefix);
 bool CX_ArrayStringAppendChar(CX_ArrayString inArray, char *inPrefix);
+bool CX_ArrayStringSave(CX_ArrayString inArray, const char *inPath, CX_Status outStatus);
+CX_ArrayString CX_ArrayStringLoadMapped(const char *inPath, CX_Status outStatus);
 
 #endif //CX_LIB_CX_ARRAYSTRING_H
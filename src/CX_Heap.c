@@ -0,0 +1,288 @@
+/**
+ * @file
+ *
+ * @brief This file implements the Heap object: a binary heap (or priority queue) of elements.
+ *
+ * The elements are stored within an Array object, in heap order: the element at position `i` is the parent of the
+ * elements at positions `2i + 1` and `2i + 2`, and it never follows them (according to the comparison function).
+ * Thus, the first element is always the next element to pop. Pushing or popping an element costs O(log(N)).
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+#include "CX_Array.h"
+#include "CX_Heap.h"
+
+/**
+ * @brief Store an element at a given position within a Heap object, and notify the position tracker (if any).
+ * @param inHeap The Heap object.
+ * @param inElements The elements of the Heap object.
+ * @param inIndex The position.
+ * @param inElement The element.
+ */
+
+static void _place(CX_Heap inHeap, void **inElements, size_t inIndex, void *inElement) {
+    inElements[inIndex] = inElement;
+    if (NULL != inHeap->moved) {
+        inHeap->moved(inElement, inIndex, inHeap->context);
+    }
+}
+
+/**
+ * @brief Move an element towards the root of a Heap object, until its parent does not follow it.
+ * @param inHeap The Heap object.
+ * @param inIndex The position of the element.
+ * @return The function returns the new position of the element.
+ */
+
+static size_t _siftUp(CX_Heap inHeap, size_t inIndex) {
+    void **elements = CX_ArrayGetElements(inHeap->array);
+    void *element = elements[inIndex];
+    while (inIndex > 0) {
+        size_t parent = (inIndex - 1) / 2;
+        if (inHeap->compare(element, elements[parent], inHeap->context) >= 0) {
+            break;
+        }
+        _place(inHeap, elements, inIndex, elements[parent]);
+        inIndex = parent;
+    }
+    _place(inHeap, elements, inIndex, element);
+    return inIndex;
+}
+
+/**
+ * @brief Move an element towards the leaves of a Heap object, until none of its children precedes it.
+ * @param inHeap The Heap object.
+ * @param inIndex The position of the element.
+ */
+
+static void _siftDown(CX_Heap inHeap, size_t inIndex) {
+    void **elements = CX_ArrayGetElements(inHeap->array);
+    size_t count = CX_ArrayGetCount(inHeap->array);
+    void *element = elements[inIndex];
+    size_t child;
+    while ((child = 2 * inIndex + 1) < count) {
+        if (child + 1 < count && inHeap->compare(elements[child + 1], elements[child], inHeap->context) < 0) {
+            child++;
+        }
+        if (inHeap->compare(elements[child], element, inHeap->context) >= 0) {
+            break;
+        }
+        _place(inHeap, elements, inIndex, elements[child]);
+        inIndex = child;
+    }
+    _place(inHeap, elements, inIndex, element);
+}
+
+/**
+ * @brief Create a new Heap object.
+ * @param inCompare Pointer to a function used to compare two elements.
+ * The signature of this function is: `int compare (void *a, void *b, void *context)`.
+ * It returns a negative value if `a` must be popped before `b`, 0 if they are equivalent, and a positive value
+ * otherwise. Thus, a comparison function that sorts the elements by increasing order gives a "min heap".
+ * @param inContext A pointer that is passed to the function `inCompare` (and to the position tracker, see
+ * `CX_HeapSetPositionTracker()`).
+ * @param elementDisposer Pointer to a function used to free an element of the Heap object (see `CX_ArrayCreate()`).
+ * @param elementCloner Pointer to a function used to clone an element of the Heap object (see `CX_ArrayCreate()`).
+ * @return Upon successful completion the function returns a new Heap object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ * @warning Please keep in mind that the returned Heap object has been **dynamically allocated**.
+ * You should free it with the function `CX_HeapDispose()`.
+ */
+
+CX_Heap CX_HeapCreate(int(*inCompare)(void*, void*, void*), void *inContext,
+        void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status)) {
+    CX_Heap heap = (CX_Heap)malloc(sizeof(struct CX_HeapType));
+    if (NULL == heap) {
+        return NULL;
+    }
+    heap->array = CX_ArrayCreate(elementDisposer, elementCloner);
+    if (NULL == heap->array) {
+        free(heap);
+        return NULL;
+    }
+    heap->compare = inCompare;
+    heap->context = inContext;
+    heap->moved = NULL;
+    return heap;
+}
+
+/**
+ * @brief Free all the resources allocated for a given Heap object.
+ *
+ * The elements are disposed, using the function provided at the heap creation (if any).
+ * @param inHeap The Heap object.
+ */
+
+void CX_HeapDispose(CX_Heap inHeap) {
+    CX_ArrayDispose(inHeap->array);
+    free(inHeap);
+}
+
+/**
+ * @brief Set the function called whenever an element is stored at a new position within a given Heap object.
+ *
+ * This function lets the caller keep track of the positions of the elements, which are needed by
+ * `CX_HeapDecreaseKey()` and `CX_HeapUpdateAt()`.
+ * @param inHeap The Heap object.
+ * @param inMoved Pointer to the function. The value NULL means that the positions are not tracked.
+ * The signature of this function is: `void moved (void *element, size_t index, void *context)`.
+ * `element`: this parameter will be assigned the element.
+ * `index`: this parameter will be assigned the new position of the element.
+ * `context`: this parameter will be assigned the context given to `CX_HeapCreate()`.
+ * @note The function is called for every pushed element. It is not called for the popped elements.
+ */
+
+void CX_HeapSetPositionTracker(CX_Heap inHeap, void(*inMoved)(void*, size_t, void*)) {
+    inHeap->moved = inMoved;
+}
+
+/**
+ * @brief Return the number of elements in a given Heap object.
+ * @param inHeap The Heap object.
+ * @return The function returns the number of elements.
+ */
+
+size_t CX_HeapGetCount(CX_Heap inHeap) {
+    return CX_ArrayGetCount(inHeap->array);
+}
+
+/**
+ * @brief Return the element at a given position within a given Heap object.
+ * @param inHeap The Heap object.
+ * @param inIndex The position. The element at position 0 is the next element to pop.
+ * @return If the position is valid, the function returns the element. Otherwise, it returns the value NULL.
+ */
+
+void *CX_HeapGetElementAt(CX_Heap inHeap, size_t inIndex) {
+    return CX_ArrayGetElementAt(inHeap->array, inIndex);
+}
+
+/**
+ * @brief Add an element to a given Heap object.
+ * @param inHeap The Heap object.
+ * @param inElement A pointer to the element to add. Please note that the added element is not cloned!
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a pointer to the added element.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ */
+
+void *CX_HeapPush(CX_Heap inHeap, void *inElement, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (NULL == CX_ArrayAdd(inHeap->array, inElement)) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    _siftUp(inHeap, CX_ArrayGetCount(inHeap->array) - 1);
+    return inElement;
+}
+
+/**
+ * @brief Add a list of elements to a given Heap object.
+ *
+ * If the number of added elements is greater than the number of elements already in the Heap object, then the
+ * elements are appended and the heap is rebuilt in O(N) ("heapify"), instead of pushing the elements one by one
+ * in O(K.log(N)).
+ * @param inHeap The Heap object.
+ * @param inElements The elements to add (pointers). Please note that the elements are not cloned!
+ * @param inCount The number of elements to add.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the Heap
+ * object is left untouched.
+ */
+
+bool CX_HeapPushMany(CX_Heap inHeap, void **inElements, size_t inCount, CX_Status outStatus) {
+    size_t count = CX_ArrayGetCount(inHeap->array);
+    if (! CX_ArrayAddMany(inHeap->array, inElements, inCount, outStatus)) {
+        return false;
+    }
+    if (inCount > count) {
+        size_t total = count + inCount;
+        for (size_t i = total / 2; i > 0; i--) {
+            _siftDown(inHeap, i - 1);
+        }
+        // Some elements have not been moved: notify the final positions of all the elements.
+        for (size_t i = 0; i < total && NULL != inHeap->moved; i++) {
+            inHeap->moved(CX_ArrayGetElements(inHeap->array)[i], i, inHeap->context);
+        }
+    } else {
+        for (size_t i = count; i < count + inCount; i++) {
+            _siftUp(inHeap, i);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Return the next element to pop from a given Heap object, without removing it.
+ * @param inHeap The Heap object.
+ * @return If the Heap object is not empty, then the function returns the element that precedes all the others.
+ * Otherwise, the function returns the value NULL.
+ */
+
+void *CX_HeapPeek(CX_Heap inHeap) {
+    return CX_ArrayGetElementAt(inHeap->array, 0);
+}
+
+/**
+ * @brief Remove the element that precedes all the others from a given Heap object.
+ * @param inHeap The Heap object.
+ * @return If the Heap object is not empty, then the function returns the removed element. Otherwise, the function
+ * returns the value NULL.
+ * @warning The removed element is not disposed: it now belongs to the caller.
+ */
+
+void *CX_HeapPop(CX_Heap inHeap) {
+    size_t count = CX_ArrayGetCount(inHeap->array);
+    if (0 == count) {
+        return NULL;
+    }
+    void **elements = CX_ArrayGetElements(inHeap->array);
+    void *first = elements[0];
+    void *last = elements[count - 1];
+    // The Array object belongs to the heap, and it is never shared: truncating it cannot fail.
+    CX_ArrayTruncate(inHeap->array, count - 1);
+    if (count > 1) {
+        elements[0] = last;
+        _siftDown(inHeap, 0);
+    }
+    return first;
+}
+
+/**
+ * @brief Restore the heap order after the key of a given element has been decreased (that is, after the element has
+ * been modified so that it must be popped sooner).
+ * @param inHeap The Heap object.
+ * @param inIndex The position of the element (see `CX_HeapSetPositionTracker()`).
+ * @return If the position is valid, the function returns the value true. Otherwise, it returns the value false.
+ * @note This operation costs O(log(N)).
+ */
+
+bool CX_HeapDecreaseKey(CX_Heap inHeap, size_t inIndex) {
+    if (inIndex >= CX_ArrayGetCount(inHeap->array)) {
+        return false;
+    }
+    _siftUp(inHeap, inIndex);
+    return true;
+}
+
+/**
+ * @brief Restore the heap order after a given element has been modified (its key may have been decreased or
+ * increased).
+ * @param inHeap The Heap object.
+ * @param inIndex The position of the element (see `CX_HeapSetPositionTracker()`).
+ * @return If the position is valid, the function returns the value true. Otherwise, it returns the value false.
+ * @note This operation costs O(log(N)).
+ */
+
+bool CX_HeapUpdateAt(CX_Heap inHeap, size_t inIndex) {
+    if (inIndex >= CX_ArrayGetCount(inHeap->array)) {
+        return false;
+    }
+    if (_siftUp(inHeap, inIndex) == inIndex) {
+        _siftDown(inHeap, inIndex);
+    }
+    return true;
+}
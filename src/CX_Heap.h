@@ -0,0 +1,21 @@
+#ifndef CX_LIB_CX_HEAP_H
+#define CX_LIB_CX_HEAP_H
+
+#include <stdbool.h>
+#include "CX_Types.h"
+#include "CX_Status.h"
+
+CX_Heap CX_HeapCreate(int(*inCompare)(void*, void*, void*), void *inContext,
+        void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status));
+void CX_HeapDispose(CX_Heap inHeap);
+void CX_HeapSetPositionTracker(CX_Heap inHeap, void(*inMoved)(void*, size_t, void*));
+size_t CX_HeapGetCount(CX_Heap inHeap);
+void *CX_HeapGetElementAt(CX_Heap inHeap, size_t inIndex);
+void *CX_HeapPush(CX_Heap inHeap, void *inElement, CX_Status outStatus);
+bool CX_HeapPushMany(CX_Heap inHeap, void **inElements, size_t inCount, CX_Status outStatus);
+void *CX_HeapPeek(CX_Heap inHeap);
+void *CX_HeapPop(CX_Heap inHeap);
+bool CX_HeapDecreaseKey(CX_Heap inHeap, size_t inIndex);
+bool CX_HeapUpdateAt(CX_Heap inHeap, size_t inIndex);
+
+#endif //CX_LIB_CX_HEAP_H
@@ -0,0 +1,289 @@
+/**
+ * @file
+ *
+ * @brief This file implements the fork-join primitives used to run the parallel algorithms of the library.
+ *
+ * A parallel algorithm splits its input into N contiguous ranges and executes N tasks: one task per range.
+ * The tasks are executed by a pool of worker threads shared by all the parallel algorithms, and by the calling
+ * thread. The function `CX_ParallelRun()` returns once all the tasks have been executed.
+ *
+ * The pool starts empty. It grows when a parallel algorithm needs more workers than it contains (up to
+ * `CX_PARALLEL_MAX_WORKERS` workers), and the workers are kept until the process exits. Thus, the threads are created
+ * once, instead of once per call to `CX_ParallelRun()`.
+ */
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "CX_Parallel.h"
+
+/*! \brief Maximum number of worker threads within the pool.
+ */
+
+#define CX_PARALLEL_MAX_WORKERS 256
+
+/**
+ * @brief A set of tasks submitted to the pool by a call to `CX_ParallelRun()`.
+ *
+ * All the fields but `task`, `context` and `count` are protected by the mutex of the pool.
+ */
+
+struct _CX_ParallelBatch {
+    CX_ParallelTask task;
+    void *context;
+    /**
+     * The total number of tasks.
+     */
+    unsigned int count;
+    /**
+     * The index of the next task to execute.
+     */
+    unsigned int next;
+    /**
+     * The number of executed tasks.
+     */
+    unsigned int done;
+    /**
+     * The next batch in the queue of the pool.
+     */
+    struct _CX_ParallelBatch *following;
+};
+
+/**
+ * @brief The pool of worker threads.
+ */
+
+struct _CX_ParallelPool {
+    pthread_mutex_t mutex;
+    /**
+     * Signaled when a batch is submitted, or when the pool is stopped.
+     */
+    pthread_cond_t submitted;
+    /**
+     * Signaled when a batch is completed.
+     */
+    pthread_cond_t completed;
+    /**
+     * The queue of the batches which tasks have not all been started.
+     */
+    struct _CX_ParallelBatch *first;
+    struct _CX_ParallelBatch *last;
+    pthread_t workers[CX_PARALLEL_MAX_WORKERS];
+    unsigned int workerCount;
+    bool stop;
+    bool stopRegistered;
+};
+
+static struct _CX_ParallelPool _pool = {
+        .mutex = PTHREAD_MUTEX_INITIALIZER,
+        .submitted = PTHREAD_COND_INITIALIZER,
+        .completed = PTHREAD_COND_INITIALIZER
+};
+
+/**
+ * @brief Take the next task of a batch of the queue.
+ * @param inBatch The batch. The value NULL means "the first batch of the queue".
+ * @param outIndex Pointer to a memory location used to store the index of the task.
+ * @return The function returns the batch the task belongs to, or the value NULL if the queue is empty.
+ * @note The caller must hold the mutex of the pool.
+ */
+
+static struct _CX_ParallelBatch *_take(struct _CX_ParallelBatch *inBatch, unsigned int *outIndex) {
+    struct _CX_ParallelBatch *batch = NULL == inBatch ? _pool.first : inBatch;
+    if (NULL == batch) {
+        return NULL;
+    }
+    *outIndex = batch->next++;
+    if (batch->next == batch->count) {
+        // All the tasks of the batch have been started: remove the batch from the queue.
+        struct _CX_ParallelBatch *previous = NULL;
+        for (struct _CX_ParallelBatch *b = _pool.first; b != batch; b = b->following) {
+            previous = b;
+        }
+        if (NULL == previous) {
+            _pool.first = batch->following;
+        } else {
+            previous->following = batch->following;
+        }
+        if (_pool.last == batch) {
+            _pool.last = previous;
+        }
+    }
+    return batch;
+}
+
+/**
+ * @brief Execute a task of a batch, and record its completion.
+ * @param inBatch The batch.
+ * @param inIndex The index of the task.
+ * @note The caller must hold the mutex of the pool. The mutex is released while the task is executed.
+ */
+
+static void _execute(struct _CX_ParallelBatch *inBatch, unsigned int inIndex) {
+    pthread_mutex_unlock(&_pool.mutex);
+    inBatch->task(inIndex, inBatch->count, inBatch->context);
+    pthread_mutex_lock(&_pool.mutex);
+    if (++inBatch->done == inBatch->count) {
+        pthread_cond_broadcast(&_pool.completed);
+    }
+}
+
+/**
+ * @brief Entry point of a worker thread.
+ * @param inUnused This parameter is not used.
+ * @return The function always returns the value NULL.
+ */
+
+static void *_worker(void *inUnused) {
+    (void)inUnused;
+    pthread_mutex_lock(&_pool.mutex);
+    while (! _pool.stop) {
+        unsigned int index;
+        struct _CX_ParallelBatch *batch = _take(NULL, &index);
+        if (NULL == batch) {
+            pthread_cond_wait(&_pool.submitted, &_pool.mutex);
+            continue;
+        }
+        _execute(batch, index);
+    }
+    pthread_mutex_unlock(&_pool.mutex);
+    return NULL;
+}
+
+/**
+ * @brief Stop the worker threads of the pool.
+ * @note This function is called when the process exits.
+ */
+
+static void _stopPool(void) {
+    pthread_mutex_lock(&_pool.mutex);
+    _pool.stop = true;
+    pthread_cond_broadcast(&_pool.submitted);
+    pthread_mutex_unlock(&_pool.mutex);
+    for (unsigned int i=0; i<_pool.workerCount; i++) {
+        pthread_join(_pool.workers[i], NULL);
+    }
+    _pool.workerCount = 0;
+}
+
+/**
+ * @brief Make sure that the pool contains a given number of workers.
+ * @param inCount The number of workers.
+ * @note If a worker cannot be created, then the pool contains less workers (possibly none). In this case, the
+ * tasks are executed by the calling threads.
+ * @note The caller must hold the mutex of the pool.
+ */
+
+static void _growPool(unsigned int inCount) {
+    if (inCount > CX_PARALLEL_MAX_WORKERS) {
+        inCount = CX_PARALLEL_MAX_WORKERS;
+    }
+    if (_pool.stop || inCount <= _pool.workerCount) {
+        return;
+    }
+    if (! _pool.stopRegistered) {
+        // The workers must be stopped when the process exits.
+        if (0 != atexit(&_stopPool)) {
+            return;
+        }
+        _pool.stopRegistered = true;
+    }
+    while (_pool.workerCount < inCount &&
+           0 == pthread_create(&_pool.workers[_pool.workerCount], NULL, &_worker, NULL)) {
+        _pool.workerCount++;
+    }
+}
+
+/**
+ * @brief Return the number of threads that should be used to process a given number of items.
+ * @param inRequested The number of threads requested by the caller.
+ * The value 0 means "as many threads as online processors".
+ * @param inItemCount The number of items to process.
+ * @param inGrain The minimum number of items a thread should process.
+ * Using a thread to process less items would cost more than it saves.
+ * @return The function returns a number of threads between 1 and `inRequested` (or the number of online processors).
+ */
+
+unsigned int CX_ParallelGetThreadCount(unsigned int inRequested, size_t inItemCount, size_t inGrain) {
+    unsigned int threads = inRequested;
+    if (0 == threads) {
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = processors > 0 ? (unsigned int)processors : 1;
+    }
+    if (0 == inGrain) {
+        inGrain = 1;
+    }
+    size_t maxThreads = inItemCount / inGrain;
+    if (maxThreads < threads) {
+        threads = 0 == maxThreads ? 1 : (unsigned int)maxThreads;
+    }
+    return threads;
+}
+
+/**
+ * @brief Execute a given task a given number of times, in parallel.
+ * @param inTaskCount The number of times the task must be executed.
+ * @param inTask The task to execute.
+ * The signature of this function is: `void task(unsigned int index, unsigned int count, void *context)`.
+ *    Where:
+ *    - "index" is the index of the execution, between 0 and `count - 1`.
+ *    - "count" is the total number of executions (that is, the value of `inTaskCount`).
+ *    - "context" is the value of the parameter `inContext`.
+ * @param inContext A pointer that is passed to all executions of the task.
+ * @note The function returns once all the executions have completed.
+ * @note The executions take place within the workers of the pool and within the calling thread. Since the calling
+ * thread executes the tasks that the workers have not started, all executions always take place (even if no worker
+ * could be created), and a task may call this function.
+ */
+
+void CX_ParallelRun(unsigned int inTaskCount, CX_ParallelTask inTask, void *inContext) {
+    if (inTaskCount <= 1) {
+        if (1 == inTaskCount) {
+            inTask(0, 1, inContext);
+        }
+        return;
+    }
+
+    struct _CX_ParallelBatch batch = {inTask, inContext, inTaskCount, 0, 0, NULL};
+
+    pthread_mutex_lock(&_pool.mutex);
+    _growPool(inTaskCount - 1);
+    if (NULL == _pool.last) {
+        _pool.first = &batch;
+    } else {
+        _pool.last->following = &batch;
+    }
+    _pool.last = &batch;
+    pthread_cond_broadcast(&_pool.submitted);
+
+    // Execute the tasks of the batch that have not been started by the workers.
+    while (batch.next < batch.count) {
+        unsigned int index;
+        _take(&batch, &index);
+        _execute(&batch, index);
+    }
+    while (batch.done < batch.count) {
+        pthread_cond_wait(&_pool.completed, &_pool.mutex);
+    }
+    pthread_mutex_unlock(&_pool.mutex);
+}
+
+/**
+ * @brief Return the range of items that must be processed by a given task.
+ *
+ * The items are split into `inTaskCount` contiguous ranges which sizes differ by at most one item.
+ * @param inItemCount The total number of items.
+ * @param inTaskIndex The index of the task.
+ * @param inTaskCount The total number of tasks.
+ * @param outBegin Pointer to a memory location used to store the index of the first item of the range.
+ * @param outEnd Pointer to a memory location used to store the index of the item that follows the last item of the
+ * range.
+ */
+
+void CX_ParallelGetRange(size_t inItemCount, unsigned int inTaskIndex, unsigned int inTaskCount,
+        size_t *outBegin, size_t *outEnd) {
+    size_t chunk = inItemCount / inTaskCount;
+    size_t remainder = inItemCount % inTaskCount;
+    *outBegin = inTaskIndex * chunk + (inTaskIndex < remainder ? inTaskIndex : remainder);
+    *outEnd = *outBegin + chunk + (inTaskIndex < remainder ? 1 : 0);
+}
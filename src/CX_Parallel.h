@@ -0,0 +1,11 @@
+#ifndef CX_LIB_CX_PARALLEL_H
+#define CX_LIB_CX_PARALLEL_H
+
+#include "CX_Types.h"
+
+unsigned int CX_ParallelGetThreadCount(unsigned int inRequested, size_t inItemCount, size_t inGrain);
+void CX_ParallelRun(unsigned int inTaskCount, CX_ParallelTask inTask, void *inContext);
+void CX_ParallelGetRange(size_t inItemCount, unsigned int inTaskIndex, unsigned int inTaskCount,
+        size_t *outBegin, size_t *outEnd);
+
+#endif //CX_LIB_CX_PARALLEL_H
@@ -0,0 +1,362 @@
+/**
+ * @file
+ *
+ * @brief This file implements the Regex object: a compiled regex that can be used many times.
+ *
+ * Compiling a regex (`regcomp()`) costs much more than matching it against a short string. A Regex object is compiled
+ * once, and then used for any number of matches. Besides, the regexes are kept within a process-wide cache (see
+ * `CX_RegexGetCached()`), so that the functions that take a regex as a zero terminated string of characters (such as
+ * `CX_StringSplitRegex()`) do not compile the same regex twice.
+ *
+ * The cache is protected by a mutex. It keeps the `CX_REGEX_CACHE_CAPACITY` most recently used regexes. A Regex
+ * object is shared by reference counting: it is freed once it has been removed from the cache and released by all its
+ * users.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include "CX_Regex.h"
+#include "CX_Array.h"
+#include "CX_ArrayString.h"
+#include "CX_String.h"
+
+/*! \brief Maximum number of regexes kept within the cache.
+ */
+
+#define CX_REGEX_CACHE_CAPACITY 64
+
+/**
+ * @brief The cache of compiled regexes.
+ */
+
+static struct {
+    /**
+     * @brief Mutex used to protect the cache.
+     */
+    pthread_mutex_t mutex;
+    /**
+     * @brief The cached regexes, from the most recently used to the least recently used.
+     */
+    CX_Regex entries[CX_REGEX_CACHE_CAPACITY];
+    /**
+     * @brief The number of cached regexes.
+     */
+    size_t count;
+} _cache = { PTHREAD_MUTEX_INITIALIZER, { NULL }, 0 };
+
+/**
+ * @brief Compute the hash of a regex (FNV-1a).
+ * @param inPattern The regex, as a zero terminated string of characters.
+ * @param inFlags The flags given to `regcomp()`.
+ * @return The function returns the hash.
+ */
+
+static size_t _hash(const char *inPattern, int inFlags) {
+    size_t hash = (size_t)14695981039346656037ULL ^ (size_t)(unsigned)inFlags;
+    for (const unsigned char *c = (const unsigned char*)inPattern; 0 != *c; c++) {
+        hash = (hash ^ *c) * (size_t)1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Look for a regex within the cache. If it is found, then it becomes the most recently used regex.
+ * @param inPattern The regex, as a zero terminated string of characters.
+ * @param inFlags The flags given to `regcomp()`.
+ * @param inHash The hash of the regex (see `_hash()`).
+ * @return If the regex is found, then the function returns a new reference to it. Otherwise, it returns the value NULL.
+ * @warning The cache must be locked by the caller.
+ */
+
+static CX_Regex _lookup(const char *inPattern, int inFlags, size_t inHash) {
+    for (size_t i = 0; i < _cache.count; i++) {
+        CX_Regex regex = _cache.entries[i];
+        if (regex->hash == inHash && regex->flags == inFlags && 0 == strcmp(regex->pattern, inPattern)) {
+            memmove(_cache.entries + 1, _cache.entries, sizeof(CX_Regex) * i);
+            _cache.entries[0] = regex;
+            __atomic_add_fetch(&regex->references, 1, __ATOMIC_RELAXED);
+            return regex;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Create a new Regex object.
+ * @param inPattern The regex, as a zero terminated string of characters.
+ * @param inFlags The flags given to `regcomp()` (for example: `REG_EXTENDED`, `REG_ICASE`...).
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a new Regex object.
+ * Otherwise, the function returns the value NULL (which means that the regex is not valid, or that the process ran out
+ * of memory).
+ * @warning Please keep in mind that the returned Regex object has been **dynamically allocated**.
+ * You should free it with the function `CX_RegexDispose()`.
+ */
+
+CX_Regex CX_RegexCreate(const char *inPattern, int inFlags, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    CX_Regex regex = (CX_Regex)malloc(sizeof(struct CX_RegexType));
+    if (NULL == regex) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    regex->pattern = strdup(inPattern);
+    if (NULL == regex->pattern) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        free(regex);
+        return NULL;
+    }
+    int code = regcomp(&regex->compiled, inPattern, inFlags);
+    if (0 != code) {
+        char message[128];
+        regerror(code, &regex->compiled, message, sizeof(message));
+        CX_StatusSetError(outStatus, 0, "Cannot compile the regex \"%s\": %s.", inPattern, message);
+        free(regex->pattern);
+        free(regex);
+        return NULL;
+    }
+    regex->flags = inFlags;
+    regex->hash = _hash(inPattern, inFlags);
+    regex->references = 1;
+    return regex;
+}
+
+/**
+ * @brief Release a reference to a given Regex object.
+ *
+ * The Regex object is freed once all its references have been released.
+ * @param inRegex The Regex object (returned by `CX_RegexCreate()` or by `CX_RegexGetCached()`).
+ */
+
+void CX_RegexDispose(CX_Regex inRegex) {
+    if (0 != __atomic_sub_fetch(&inRegex->references, 1, __ATOMIC_ACQ_REL)) {
+        return;
+    }
+    regfree(&inRegex->compiled);
+    free(inRegex->pattern);
+    free(inRegex);
+}
+
+/**
+ * @brief Return a compiled regex from the process-wide cache of regexes.
+ *
+ * If the regex (given its pattern and its flags) is not in the cache, then it is compiled and added to the cache. If
+ * the cache is full, then the least recently used regex is removed from the cache. This function is thread-safe, and
+ * the regex is compiled outside the lock.
+ * @param inPattern The regex, as a zero terminated string of characters.
+ * @param inFlags The flags given to `regcomp()` (for example: `REG_EXTENDED`, `REG_ICASE`...).
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a reference to the Regex object.
+ * Otherwise, the function returns the value NULL (which means that the regex is not valid, or that the process ran out
+ * of memory).
+ * @warning Once you don't need the returned Regex object anymore, you should release it with the function
+ * `CX_RegexDispose()`. It remains valid until then, even if it is removed from the cache.
+ */
+
+CX_Regex CX_RegexGetCached(const char *inPattern, int inFlags, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    size_t hash = _hash(inPattern, inFlags);
+    pthread_mutex_lock(&_cache.mutex);
+    CX_Regex regex = _lookup(inPattern, inFlags, hash);
+    pthread_mutex_unlock(&_cache.mutex);
+    if (NULL != regex) {
+        return regex;
+    }
+
+    CX_Regex compiled = CX_RegexCreate(inPattern, inFlags, outStatus);
+    if (NULL == compiled) {
+        return NULL;
+    }
+    CX_Regex evicted = NULL;
+    pthread_mutex_lock(&_cache.mutex);
+    // Another thread may have added the same regex in the meantime.
+    regex = _lookup(inPattern, inFlags, hash);
+    if (NULL == regex) {
+        if (CX_REGEX_CACHE_CAPACITY == _cache.count) {
+            evicted = _cache.entries[--_cache.count];
+        }
+        memmove(_cache.entries + 1, _cache.entries, sizeof(CX_Regex) * _cache.count);
+        _cache.entries[0] = compiled;
+        _cache.count += 1;
+        // One reference for the cache, one for the caller.
+        compiled->references = 2;
+        regex = compiled;
+        compiled = NULL;
+    }
+    pthread_mutex_unlock(&_cache.mutex);
+    if (NULL != compiled) {
+        CX_RegexDispose(compiled);
+    }
+    if (NULL != evicted) {
+        CX_RegexDispose(evicted);
+    }
+    return regex;
+}
+
+/**
+ * @brief Remove all the regexes from the process-wide cache of regexes.
+ *
+ * The regexes that are still used (see `CX_RegexGetCached()`) are freed once they are released.
+ */
+
+void CX_RegexCacheClear(void) {
+    pthread_mutex_lock(&_cache.mutex);
+    size_t count = _cache.count;
+    CX_Regex entries[CX_REGEX_CACHE_CAPACITY];
+    memcpy(entries, _cache.entries, sizeof(CX_Regex) * count);
+    _cache.count = 0;
+    pthread_mutex_unlock(&_cache.mutex);
+    for (size_t i = 0; i < count; i++) {
+        CX_RegexDispose(entries[i]);
+    }
+}
+
+/**
+ * @brief Return the number of regexes within the process-wide cache of regexes.
+ * @return The function returns the number of regexes.
+ */
+
+size_t CX_RegexCacheGetCount(void) {
+    pthread_mutex_lock(&_cache.mutex);
+    size_t count = _cache.count;
+    pthread_mutex_unlock(&_cache.mutex);
+    return count;
+}
+
+/**
+ * @brief Return the pattern of a given Regex object.
+ * @param inRegex The Regex object.
+ * @return The function returns the pattern, as a zero terminated string of characters.
+ */
+
+const char *CX_RegexGetPattern(CX_Regex inRegex) {
+    return inRegex->pattern;
+}
+
+/**
+ * @brief Search for the first match of a given Regex object within a zero terminated string of characters.
+ * @param inRegex The Regex object.
+ * @param inChars The zero terminated string of characters.
+ * @param outStart Pointer to a memory location used to store the position of the first character of the match.
+ * The value NULL means that the position is not needed.
+ * @param outEnd Pointer to a memory location used to store the position of the first character that follows the match.
+ * The value NULL means that the position is not needed.
+ * @return If the Regex object matches, then the function returns the value true. Otherwise, it returns the value false.
+ * @note This function is thread-safe: a Regex object can be used by several threads at the same time.
+ */
+
+bool CX_RegexMatch(CX_Regex inRegex, const char *inChars, size_t *outStart, size_t *outEnd) {
+    regmatch_t matches[1];
+    if (0 != regexec(&inRegex->compiled, inChars, 1, matches, 0)) {
+        return false;
+    }
+    if (NULL != outStart) {
+        *outStart = (size_t)matches[0].rm_so;
+    }
+    if (NULL != outEnd) {
+        *outEnd = (size_t)matches[0].rm_eo;
+    }
+    return true;
+}
+
+/**
+ * @brief Split a String object, using a Regex object to represent the boundary, and store the positions of the tokens
+ * into a given SplitIndex object.
+ * @param inRegex The Regex object. If it matches an empty string, then the String object is not split any further.
+ * @param inString The String object to split. It must not be modified (or freed) while the tokens are used.
+ * @param outIndex The SplitIndex object. Its previous tokens are removed.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory).
+ */
+
+bool CX_RegexSplitIndex(CX_Regex inRegex, CX_String inString, CX_SplitIndex outIndex, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! CX_ArrayTruncate(outIndex->tokens, 0)) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return false;
+    }
+    outIndex->source = NULL == SL_StringGetString(inString) ? "" : SL_StringGetString(inString);
+    size_t offset = 0, start, end;
+    for (;;) {
+        bool found = CX_RegexMatch(inRegex, outIndex->source + offset, &start, &end) && end > start;
+        CX_SplitToken token = { offset, found ? start : strlen(outIndex->source + offset) };
+        if (NULL == CX_ArrayAddValue(outIndex->tokens, &token)) {
+            CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+            return false;
+        }
+        if (! found) {
+            return true;
+        }
+        offset += end;
+    }
+}
+
+/**
+ * @brief Split a String object into a list of String objects, using a Regex object to represent the boundary.
+ * @param inRegex The Regex object. If it matches an empty string, then the String object is not split any further.
+ * @param inString The String object to split.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns an ArrayString object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ * @warning The returned ArrayString object has been **dynamically allocated**.
+ * Therefore, once you don't need it anymore, you should free it.
+ * To do that you must call the function `CX_ArrayStringDispose()`.
+ */
+
+CX_ArrayString CX_RegexSplit(CX_Regex inRegex, CX_String inString, CX_Status outStatus) {
+    CX_SplitIndex index = CX_SplitIndexCreate();
+    if (NULL == index) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    if (! CX_RegexSplitIndex(inRegex, inString, index, outStatus)) {
+        CX_SplitIndexDispose(index);
+        return NULL;
+    }
+    CX_ArrayString array = CX_ArrayStringCreate(NULL);
+    for (size_t i = 0; NULL != array && i < CX_SplitIndexGetCount(index); i++) {
+        CX_String element = CX_SplitIndexGetStringAt(index, i);
+        if (NULL == element || NULL == CX_ArrayAdd((CX_Array) array, element)) {
+            if (NULL != element) {
+                CX_StringDispose(element);
+            }
+            CX_ArrayStringDispose(array);
+            array = NULL;
+        }
+    }
+    CX_SplitIndexDispose(index);
+    if (NULL == array) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+    }
+    return array;
+}
+
+/**
+ * @brief Replace all the matches of a Regex object within a given String object by a zero terminated string of
+ * characters.
+ * @param inRegex The Regex object. If it matches an empty string, then no replacement is made from there.
+ * @param inString The String object that contains the matches to replace.
+ * @param inReplacement A zero terminated string of characters that represents the replacement.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a newly allocated String object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ * @warning The returned String object has been **dynamically allocated**.
+ * Therefore, once you don't need it anymore, you should free it.
+ * To do that you must call the function `CX_StringDispose()`.
+ */
+
+CX_String CX_RegexReplace(CX_Regex inRegex, CX_String inString, char *inReplacement, CX_Status outStatus) {
+    CX_ArrayString array = CX_RegexSplit(inRegex, inString, outStatus);
+    if (NULL == array) {
+        return NULL;
+    }
+    CX_String result = CX_ArrayStringJoinChar(array, inReplacement);
+    CX_ArrayStringDispose(array);
+    if (NULL == result) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+    }
+    return result;
+}
@@ -0,0 +1,19 @@
+#ifndef CX_LIB_CX_REGEX_H
+#define CX_LIB_CX_REGEX_H
+
+#include <stdbool.h>
+#include "CX_Types.h"
+#include "CX_Status.h"
+
+CX_Regex CX_RegexCreate(const char *inPattern, int inFlags, CX_Status outStatus);
+void CX_RegexDispose(CX_Regex inRegex);
+CX_Regex CX_RegexGetCached(const char *inPattern, int inFlags, CX_Status outStatus);
+void CX_RegexCacheClear(void);
+size_t CX_RegexCacheGetCount(void);
+const char *CX_RegexGetPattern(CX_Regex inRegex);
+bool CX_RegexMatch(CX_Regex inRegex, const char *inChars, size_t *outStart, size_t *outEnd);
+bool CX_RegexSplitIndex(CX_Regex inRegex, CX_String inString, CX_SplitIndex outIndex, CX_Status outStatus);
+CX_ArrayString CX_RegexSplit(CX_Regex inRegex, CX_String inString, CX_Status outStatus);
+CX_String CX_RegexReplace(CX_Regex inRegex, CX_String inString, char *inReplacement, CX_Status outStatus);
+
+#endif //CX_LIB_CX_REGEX_H
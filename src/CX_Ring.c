@@ -0,0 +1,334 @@
+/**
+ * @file
+ *
+ * @brief This file implements the Ring object: a FIFO queue of elements stored within a circular buffer.
+ *
+ * The number of slots of the buffer is a power of two, so that a position within the buffer is computed with a mask.
+ * Enqueuing or dequeuing an element costs O(1), and it never moves the other elements. Once the buffer is large
+ * enough, a FIFO workload does not allocate memory anymore.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include "CX_Ring.h"
+
+/*! \brief Minimum number of slots of the buffer of a Ring object.
+ */
+
+#define CX_RING_MIN_CAPACITY 8
+
+/**
+ * @brief Return the position, within the buffer of a given Ring object, of the element at a given position within
+ * the queue.
+ * @param inRing The Ring object.
+ * @param inIndex The position within the queue (0 is the oldest element).
+ * @return The function returns the position within the buffer.
+ */
+
+static size_t _slot(CX_Ring inRing, size_t inIndex) {
+    return (inRing->head + inIndex) & (inRing->capacity - 1);
+}
+
+/**
+ * @brief Return the smallest power of two that is greater than, or equal to, a given number of slots.
+ * @param inCount The number of slots.
+ * @param outCapacity Pointer to a memory location used to store the power of two.
+ * @return If the power of two can be represented (as a number of bytes), then the function returns the value true.
+ * Otherwise, it returns the value false.
+ */
+
+static bool _roundCapacity(size_t inCount, size_t *outCapacity) {
+    size_t capacity = CX_RING_MIN_CAPACITY;
+    while (capacity < inCount) {
+        if (capacity > SIZE_MAX / sizeof(void*) / 2) {
+            return false;
+        }
+        capacity *= 2;
+    }
+    *outCapacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Copy a range of elements of a given Ring object into a contiguous buffer.
+ * @param inRing The Ring object.
+ * @param inIndex The position of the first element within the queue.
+ * @param inCount The number of elements to copy.
+ * @param outElements The buffer.
+ */
+
+static void _copyOut(CX_Ring inRing, size_t inIndex, size_t inCount, void **outElements) {
+    size_t first = _slot(inRing, inIndex);
+    size_t part = inRing->capacity - first < inCount ? inRing->capacity - first : inCount;
+    memcpy(outElements, inRing->elements + first, sizeof(void*) * part);
+    memcpy(outElements + part, inRing->elements, sizeof(void*) * (inCount - part));
+}
+
+/**
+ * @brief Make sure that a given number of elements can be added to a given Ring object.
+ *
+ * If the Ring object is growable and if its buffer is too small, then the buffer is replaced by a buffer (at least)
+ * twice as large. Thus, adding N elements costs O(N) amortized.
+ * @param inRing The Ring object.
+ * @param inCount The number of elements to add.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the Ring object is full, or that the process ran out of
+ * memory). In this case, the Ring object is left untouched.
+ */
+
+static bool _reserve(CX_Ring inRing, size_t inCount) {
+    if (inCount <= inRing->capacity - inRing->count) {
+        return true;
+    }
+    size_t capacity;
+    if (! inRing->growable || inCount > SIZE_MAX - inRing->count ||
+        ! _roundCapacity(inRing->count + inCount, &capacity)) {
+        return false;
+    }
+    void **elements = (void**)malloc(sizeof(void*) * capacity);
+    if (NULL == elements) {
+        return false;
+    }
+    _copyOut(inRing, 0, inRing->count, elements);
+    free(inRing->elements);
+    inRing->elements = elements;
+    inRing->capacity = capacity;
+    inRing->head = 0;
+    return true;
+}
+
+/**
+ * @brief Create a new Ring object.
+ * @param inCapacity The number of elements the Ring object can hold before its buffer must be enlarged. It is rounded
+ * up to a power of two.
+ * @param inGrowable This flag tells whether the buffer is enlarged when the Ring object is full (true), or not
+ * (false). If the buffer is not enlarged, then no element can be added to a full Ring object.
+ * @param elementDisposer Pointer to a function used to free an element of the Ring object (see `CX_ArrayCreate()`).
+ * @param elementCloner Pointer to a function used to clone an element of the Ring object (see `CX_ArrayCreate()`).
+ * @return Upon successful completion the function returns a new Ring object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ * @warning Please keep in mind that the returned Ring object has been **dynamically allocated**.
+ * You should free it with the function `CX_RingDispose()`.
+ */
+
+CX_Ring CX_RingCreate(size_t inCapacity, bool inGrowable,
+        void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status)) {
+    size_t capacity;
+    if (! _roundCapacity(inCapacity, &capacity)) {
+        return NULL;
+    }
+    CX_Ring ring = (CX_Ring)malloc(sizeof(struct CX_RingType));
+    if (NULL == ring) {
+        return NULL;
+    }
+    ring->elements = (void**)malloc(sizeof(void*) * capacity);
+    if (NULL == ring->elements) {
+        free(ring);
+        return NULL;
+    }
+    ring->capacity = capacity;
+    ring->head = 0;
+    ring->count = 0;
+    ring->growable = inGrowable;
+    ring->elementDisposer = elementDisposer;
+    ring->elementCloner = elementCloner;
+    return ring;
+}
+
+/**
+ * @brief Free all the resources allocated for a given Ring object.
+ *
+ * The elements are disposed, using the function provided at the ring creation (if any).
+ * @param inRing The Ring object.
+ */
+
+void CX_RingDispose(CX_Ring inRing) {
+    CX_RingClear(inRing);
+    free(inRing->elements);
+    free(inRing);
+}
+
+/**
+ * @brief Clone a given Ring object.
+ * @param inRing The Ring object to clone.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a clone of the given Ring object.
+ * Otherwise the function returns the value NULL (which means that the process ran out of memory, that an element
+ * could not be cloned, or that no cloner was provided at the ring creation).
+ * @note The clone has the same capacity as the given Ring object: a fixed-size clone accepts as many elements as the
+ * given Ring object.
+ * @warning Please keep in mind that the returned Ring object has been **dynamically allocated**.
+ * You should free it with the function `CX_RingDispose()`.
+ */
+
+CX_Ring CX_RingDup(CX_Ring inRing, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (NULL == inRing->elementCloner) {
+        CX_StatusSetError(outStatus, 0, "Cannot clone a ring which has no element cloner!");
+        return NULL;
+    }
+    CX_Ring clone = CX_RingCreate(inRing->capacity, inRing->growable, inRing->elementDisposer, inRing->elementCloner);
+    if (NULL == clone) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+        return NULL;
+    }
+    for (size_t i=0; i<inRing->count; i++) {
+        void *element = inRing->elementCloner(inRing->elements[_slot(inRing, i)], outStatus);
+        if (NULL == element) {
+            // The status is set.
+            CX_RingDispose(clone);
+            return NULL;
+        }
+        clone->elements[clone->count++] = element;
+    }
+    return clone;
+}
+
+/**
+ * @brief Return the number of elements in a given Ring object.
+ * @param inRing The Ring object.
+ * @return The function returns the number of elements.
+ */
+
+size_t CX_RingGetCount(CX_Ring inRing) {
+    return inRing->count;
+}
+
+/**
+ * @brief Return the number of elements a given Ring object can hold without enlarging its buffer.
+ * @param inRing The Ring object.
+ * @return The function returns the number of elements (a power of two).
+ */
+
+size_t CX_RingGetCapacity(CX_Ring inRing) {
+    return inRing->capacity;
+}
+
+/**
+ * @brief Return the element at a given position within a given Ring object.
+ * @param inRing The Ring object.
+ * @param inIndex The position. The element at position 0 is the oldest element (that is, the next element to
+ * dequeue).
+ * @return If the position is valid, the function returns the element. Otherwise, it returns the value NULL.
+ */
+
+void *CX_RingGetElementAt(CX_Ring inRing, size_t inIndex) {
+    if (inIndex >= inRing->count) {
+        return NULL;
+    }
+    return inRing->elements[_slot(inRing, inIndex)];
+}
+
+/**
+ * @brief Return the oldest element of a given Ring object, without removing it.
+ * @param inRing The Ring object.
+ * @return If the Ring object is not empty, then the function returns the oldest element.
+ * Otherwise, the function returns the value NULL.
+ */
+
+void *CX_RingPeek(CX_Ring inRing) {
+    return CX_RingGetElementAt(inRing, 0);
+}
+
+/**
+ * @brief Add an element at the end of a given Ring object.
+ * @param inRing The Ring object.
+ * @param inElement A pointer to the element to add. Please note that the added element is not cloned!
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns a pointer to the added element.
+ * Otherwise, the function returns the value NULL (which means that the Ring object is full, or that the process ran
+ * out of memory).
+ */
+
+void *CX_RingEnqueue(CX_Ring inRing, void *inElement, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (! _reserve(inRing, 1)) {
+        CX_StatusSetError(outStatus, inRing->growable ? errno : 0,
+                          inRing->growable ? "Cannot allocate memory!" : "The ring is full!");
+        return NULL;
+    }
+    inRing->elements[_slot(inRing, inRing->count)] = inElement;
+    inRing->count += 1;
+    return inElement;
+}
+
+/**
+ * @brief Add a list of elements at the end of a given Ring object.
+ * @param inRing The Ring object.
+ * @param inElements The elements to add (pointers). Please note that the elements are not cloned!
+ * @param inCount The number of elements to add.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the Ring object cannot hold all the elements, or that the
+ * process ran out of memory). In this case, no element is added.
+ */
+
+bool CX_RingEnqueueMany(CX_Ring inRing, void **inElements, size_t inCount, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    if (0 == inCount) {
+        return true;
+    }
+    if (! _reserve(inRing, inCount)) {
+        CX_StatusSetError(outStatus, inRing->growable ? errno : 0,
+                          inRing->growable ? "Cannot allocate memory!" : "The ring is full!");
+        return false;
+    }
+    size_t first = _slot(inRing, inRing->count);
+    size_t part = inRing->capacity - first < inCount ? inRing->capacity - first : inCount;
+    memcpy(inRing->elements + first, inElements, sizeof(void*) * part);
+    memcpy(inRing->elements, inElements + part, sizeof(void*) * (inCount - part));
+    inRing->count += inCount;
+    return true;
+}
+
+/**
+ * @brief Remove the oldest element from a given Ring object.
+ * @param inRing The Ring object.
+ * @return If the Ring object is not empty, then the function returns the removed element. Otherwise, the function
+ * returns the value NULL.
+ * @warning The removed element is not disposed: it now belongs to the caller.
+ */
+
+void *CX_RingDequeue(CX_Ring inRing) {
+    if (0 == inRing->count) {
+        return NULL;
+    }
+    void *element = inRing->elements[inRing->head];
+    inRing->head = _slot(inRing, 1);
+    inRing->count -= 1;
+    return element;
+}
+
+/**
+ * @brief Remove the oldest elements from a given Ring object.
+ * @param inRing The Ring object.
+ * @param outElements The buffer used to store the removed elements, from the oldest to the newest.
+ * @param inMaxCount The maximum number of elements to remove (that is, the number of slots of the buffer).
+ * @return The function returns the number of removed elements.
+ * @warning The removed elements are not disposed: they now belong to the caller.
+ */
+
+size_t CX_RingDequeueMany(CX_Ring inRing, void **outElements, size_t inMaxCount) {
+    size_t count = inMaxCount < inRing->count ? inMaxCount : inRing->count;
+    _copyOut(inRing, 0, count, outElements);
+    inRing->head = _slot(inRing, count);
+    inRing->count -= count;
+    return count;
+}
+
+/**
+ * @brief Remove all the elements from a given Ring object.
+ *
+ * The elements are disposed, using the function provided at the ring creation (if any). The buffer is kept.
+ * @param inRing The Ring object.
+ */
+
+void CX_RingClear(CX_Ring inRing) {
+    for (size_t i=0; i<inRing->count && NULL != inRing->elementDisposer; i++) {
+        inRing->elementDisposer(inRing->elements[_slot(inRing, i)]);
+    }
+    inRing->head = 0;
+    inRing->count = 0;
+}
@@ -0,0 +1,22 @@
+#ifndef CX_LIB_CX_RING_H
+#define CX_LIB_CX_RING_H
+
+#include <stdbool.h>
+#include "CX_Types.h"
+#include "CX_Status.h"
+
+CX_Ring CX_RingCreate(size_t inCapacity, bool inGrowable,
+        void(*elementDisposer)(void*), void*(*elementCloner)(void*, CX_Status));
+void CX_RingDispose(CX_Ring inRing);
+CX_Ring CX_RingDup(CX_Ring inRing, CX_Status outStatus);
+size_t CX_RingGetCount(CX_Ring inRing);
+size_t CX_RingGetCapacity(CX_Ring inRing);
+void *CX_RingGetElementAt(CX_Ring inRing, size_t inIndex);
+void *CX_RingPeek(CX_Ring inRing);
+void *CX_RingEnqueue(CX_Ring inRing, void *inElement, CX_Status outStatus);
+bool CX_RingEnqueueMany(CX_Ring inRing, void **inElements, size_t inCount, CX_Status outStatus);
+void *CX_RingDequeue(CX_Ring inRing);
+size_t CX_RingDequeueMany(CX_Ring inRing, void **outElements, size_t inMaxCount);
+void CX_RingClear(CX_Ring inRing);
+
+#endif //CX_LIB_CX_RING_H
@@ -6,15 +6,204 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <regex.h>
 #include <errno.h>
 #include <stdarg.h>
+#include <limits.h>
 #include "CX_String.h"
 #include "CX_Array.h"
+#include "CX_Regex.h"
 
 char *_getStringFmt(const char *inFmt, va_list args);
 
+/*! \brief Minimum number of bytes allocated when a String object grows out of its small buffer.
+ */
+
+#define CX_STRING_MIN_CAPACITY (2 * CX_STRING_SMALL_CAPACITY)
+
+/*! \brief Return the container of a given String object.
+ */
+
+#define CX_STRING_HEADER(s) ((struct CX_StringType*)(s))
+
+#if defined(__GNUC__) && defined(__SSE2__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+
+/*! \brief This macro is defined if the single-byte delimiter search uses SSE2/AVX2 instructions.
+ */
+
+#define CX_STRING_SIMD_X86
+#endif
+
+/**
+ * @brief This structure represents a delimiter prepared for repeated searches (see `_prepareFinder()`).
+ */
+
+struct CX_StringFinder {
+    /**
+     * @brief The delimiter.
+     */
+    const unsigned char *delimiter;
+    /**
+     * @brief The number of characters of the delimiter.
+     */
+    size_t length;
+    /**
+     * @brief Function used to search for a single-byte delimiter.
+     */
+    const char *(*findByte)(const char*, size_t, unsigned char);
+    /**
+     * @brief The Horspool shift table: the number of positions the search window moves when its last character is
+     * a given byte (only used for delimiters longer than one character).
+     */
+    size_t shift[UCHAR_MAX + 1];
+};
+
+/**
+ * @brief Test whether the buffer of a given String object has been allocated for it (and, thus, must be freed with it).
+ * @param inHeader The container of the String object.
+ * @return The function returns the value false if the String object is empty, if its buffer is its small buffer, or
+ * if its buffer does not belong to it. Otherwise, it returns the value true.
+ */
+
+static bool _ownsBuffer(struct CX_StringType *inHeader) {
+    return 0 != inHeader->capacity && inHeader->string != inHeader->small;
+}
+
+/**
+ * @brief Create a String object from a given sequence of characters.
+ *
+ * A short string is stored within the String container: creating it costs a single allocation.
+ * @param inChars The characters. This value may be NULL (if `inLength` is 0).
+ * @param inLength The number of characters.
+ * @return Upon successful completion the function returns a pointer to a dynamically allocated String object.
+ * Otherwise, the function returns the value NULL (which means that the process runs out of memory).
+ */
+
+static CX_String _create(const char *inChars, size_t inLength) {
+    struct CX_StringType *header = (struct CX_StringType*)malloc(sizeof(struct CX_StringType));
+    if (NULL == header) {
+        return NULL;
+    }
+    if (inLength < CX_STRING_SMALL_CAPACITY) {
+        header->string = header->small;
+        header->capacity = CX_STRING_SMALL_CAPACITY;
+    } else {
+        header->string = (char*)malloc(inLength + 1);
+        if (NULL == header->string) {
+            free(header);
+            return NULL;
+        }
+        header->capacity = inLength + 1;
+    }
+    if (inLength > 0) {
+        memcpy(header->string, inChars, inLength);
+    }
+    header->string[inLength] = 0;
+    header->length = inLength;
+    return &header->string;
+}
+
+/**
+ * @brief Make sure that a given String object can hold a given number of characters.
+ *
+ * If the buffer is too small, then it is replaced by a buffer (at least) twice as large. Thus, appending N characters
+ * costs O(N) amortized. If the buffer is the small buffer of the String object, or if it does not belong to the String
+ * object, then its content is copied into the new buffer.
+ * @param inString The String object.
+ * @param inLength The number of characters (excluding the terminating zero).
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the String
+ * object is left untouched.
+ */
+
+static bool _reserve(CX_String inString, size_t inLength) {
+    struct CX_StringType *header = CX_STRING_HEADER(inString);
+    if (inLength < header->capacity) {
+        return true;
+    }
+    if (NULL == header->string && inLength < CX_STRING_SMALL_CAPACITY) {
+        // The String object is empty: the characters fit into its small buffer.
+        header->small[0] = 0;
+        header->string = header->small;
+        header->capacity = CX_STRING_SMALL_CAPACITY;
+        return true;
+    }
+    if (inLength >= SIZE_MAX / 2) {
+        return false;
+    }
+    size_t capacity = header->capacity < CX_STRING_MIN_CAPACITY ? CX_STRING_MIN_CAPACITY : header->capacity;
+    while (capacity <= inLength) {
+        capacity *= 2;
+    }
+    char *string;
+    if (! _ownsBuffer(header)) {
+        string = (char*)malloc(capacity);
+        if (NULL == string) {
+            return false;
+        }
+        if (NULL == header->string) {
+            string[0] = 0;
+        } else {
+            memcpy(string, header->string, header->length + 1);
+        }
+    } else {
+        string = (char*)realloc(header->string, capacity);
+        if (NULL == string) {
+            return false;
+        }
+    }
+    header->string = string;
+    header->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Insert a sequence of characters at the beginning, or at the end, of a given String object.
+ * @param inString The String object.
+ * @param inChars The characters. They may belong to the String object itself.
+ * @param inLength The number of characters.
+ * @param inPrepend This flag tells whether the characters are inserted at the beginning (true), or at the end (false).
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the String
+ * object is left untouched.
+ */
+
+static bool _insert(CX_String inString, const char *inChars, size_t inLength, bool inPrepend) {
+    struct CX_StringType *header = CX_STRING_HEADER(inString);
+    if (inLength > SIZE_MAX - header->length - 1) {
+        return false;
+    }
+    // The buffer may move: the characters that belong to it are located by their offset.
+    bool inside = NULL != header->string && inChars >= header->string && inChars <= header->string + header->length;
+    size_t offset = inside ? (size_t)(inChars - header->string) : 0;
+    if (! _reserve(inString, header->length + inLength)) {
+        return false;
+    }
+    if (inside) {
+        inChars = header->string + offset;
+    }
+    if (inPrepend) {
+        memmove(header->string + inLength, header->string, header->length + 1);
+        if (inside) {
+            // The characters have been moved as well.
+            inChars += inLength;
+        }
+        if (inLength > 0) {
+            memcpy(header->string, inChars, inLength);
+        }
+    } else {
+        if (inLength > 0) {
+            memcpy(header->string + header->length, inChars, inLength);
+        }
+        header->string[header->length + inLength] = 0;
+    }
+    header->length += inLength;
+    return true;
+}
+
 /**
  * @brief Create a String object.
  * @param inString Pointer to a zero terminated string of characters used to initialize the new String.
@@ -35,19 +224,17 @@ char *_getStringFmt(const char *inFmt, va_list args);
  */
 
 CX_String CX_StringCreate(char *inString) {
-    CX_String string = (CX_String)malloc(sizeof(char*));
-    if (NULL == string) {
-        return NULL;
+    if (NULL != inString) {
+        return _create(inString, strlen(inString));
     }
-    if (NULL == inString) {
-        SL_StringGetString(string) = NULL;
-    } else {
-        SL_StringGetString(string) = strdup(inString);
-        if (NULL == SL_StringGetString(string)) {
-            return NULL;
-        }
+    struct CX_StringType *header = (struct CX_StringType*)malloc(sizeof(struct CX_StringType));
+    if (NULL == header) {
+        return NULL;
     }
-    return string;
+    header->string = NULL;
+    header->length = 0;
+    header->capacity = 0;
+    return &header->string;
 }
 
 /**
@@ -82,10 +269,10 @@ CX_String CX_StringCreateFmt(const char *inFmt, ...) {
  */
 
 CX_String CX_StringDispose(CX_String inString) {
-    if (NULL != SL_StringGetString(inString)) {
+    if (_ownsBuffer(CX_STRING_HEADER(inString))) {
         free(SL_StringGetString(inString));
     }
-    free(inString);
+    free(CX_STRING_HEADER(inString));
 }
 
 /**
@@ -99,20 +286,21 @@ CX_String CX_StringDispose(CX_String inString) {
  */
 
 CX_String CX_StringDup(CX_String inString) {
-    return CX_StringCreate(SL_StringGetString(inString));
+    if (NULL == SL_StringGetString(inString)) {
+        return CX_StringCreate(NULL);
+    }
+    return _create(SL_StringGetString(inString), CX_STRING_HEADER(inString)->length);
 }
 
 /**
  * @brief Returns the number of characters in a given String object.
  * @param inString The String object.
  * @return The function returns the number of characters in the given String object.
+ * @note The length is stored within the String object: this function costs O(1).
  */
 
 size_t CX_StringLength(CX_String inString) {
-    if (NULL == SL_StringGetString(inString)) {
-        return 0;
-    }
-    return strlen(SL_StringGetString(inString));
+    return CX_STRING_HEADER(inString)->length;
 }
 
 /**
@@ -120,19 +308,13 @@ size_t CX_StringLength(CX_String inString) {
  * @param inString The String object.
  * @param inToAppend the zero terminated string of characters to append.
  * @return Upon successful completion the function returns the value true.
- * Otherwise, it returns the value false (which means that the process ran out of memory).
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the String
+ * object is left untouched.
+ * @note The buffer grows geometrically: appending N characters costs O(N) amortized.
  */
 
 bool CX_StringAppendChar(CX_String inString, char *inToAppend) {
-    unsigned long currentLength = NULL == SL_StringGetString(inString) ? 0 : strlen(SL_StringGetString(inString));
-    unsigned long newTotalLength = currentLength + strlen(inToAppend) + 1;
-
-    *inString = (char*)realloc((void*)*inString, newTotalLength);
-    if (NULL == SL_StringGetString(inString)) {
-        return false;
-    }
-    strcpy(SL_StringGetString(inString) + currentLength, inToAppend);
-    return true;
+    return _insert(inString, inToAppend, strlen(inToAppend), false);
 }
 
 /**
@@ -140,25 +322,14 @@ bool CX_StringAppendChar(CX_String inString, char *inToAppend) {
  * @param inString The String object.
  * @param inToPrepend the zero terminated string of characters to prepend.
  * @return Upon successful completion the function returns the value true.
- * Otherwise, it returns the value false (which means that the process ran out of memory).
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the String
+ * object is left untouched.
+ * @note Prepending moves all the characters of the String object. To build a string front to back, use a
+ * StringBuilder object (see `CX_StringBuilderPrepend()`).
  */
 
 bool CX_StringPrependChar(CX_String inString, char *inToPrepend) {
-    unsigned long currentLength = NULL == SL_StringGetString(inString) ? 0 : strlen(SL_StringGetString(inString));
-    unsigned long newTotalLength = currentLength + strlen(inToPrepend) + 1;
-
-    char *newString = (char*)malloc(newTotalLength);
-    if (NULL == newString) {
-        return false;
-    }
-    strcpy(newString, inToPrepend);
-    if (NULL != SL_StringGetString(inString)) {
-        strcpy(newString+strlen(inToPrepend), SL_StringGetString(inString));
-    }
-    free(SL_StringGetString(inString));
-    SL_StringGetString(inString) = newString;
-
-    return true;
+    return _insert(inString, inToPrepend, strlen(inToPrepend), true);
 }
 
 /**
@@ -170,7 +341,7 @@ bool CX_StringPrependChar(CX_String inString, char *inToPrepend) {
  */
 
 bool CX_StringPrepend(CX_String inString, CX_String inToPrepend) {
-    return CX_StringPrependChar(inString, SL_StringGetString(inToPrepend));
+    return _insert(inString, SL_StringGetString(inToPrepend), CX_STRING_HEADER(inToPrepend)->length, true);
 }
 
 /**
@@ -182,14 +353,153 @@ bool CX_StringPrepend(CX_String inString, CX_String inToPrepend) {
  */
 
 bool CX_StringAppend(CX_String inString, CX_String inToAppend) {
-    return CX_StringAppendChar(inString, SL_StringGetString(inToAppend));
+    return _insert(inString, SL_StringGetString(inToAppend), CX_STRING_HEADER(inToAppend)->length, false);
+}
+
+/**
+ * @brief Search for a byte within a sequence of characters (portable version).
+ * @param inChars The characters.
+ * @param inLength The number of characters.
+ * @param inByte The byte to search for.
+ * @return If the byte is found, then the function returns a pointer to its first occurrence.
+ * Otherwise, it returns the value NULL.
+ */
+
+static const char *_findByte(const char *inChars, size_t inLength, unsigned char inByte) {
+    return (const char*)memchr(inChars, inByte, inLength);
+}
+
+#ifdef CX_STRING_SIMD_X86
+
+/**
+ * @brief Search for a byte within a sequence of characters, 16 characters at a time (SSE2 version).
+ * @param inChars The characters.
+ * @param inLength The number of characters.
+ * @param inByte The byte to search for.
+ * @return If the byte is found, then the function returns a pointer to its first occurrence.
+ * Otherwise, it returns the value NULL.
+ */
+
+static const char *_findByteSSE2(const char *inChars, size_t inLength, unsigned char inByte) {
+    const __m128i needle = _mm_set1_epi8((char)inByte);
+    size_t i = 0;
+    for (; i + 16 <= inLength; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(inChars + i));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+        if (0 != mask) {
+            return inChars + i + __builtin_ctz(mask);
+        }
+    }
+    for (; i < inLength; i++) {
+        if ((unsigned char)inChars[i] == inByte) {
+            return inChars + i;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Search for a byte within a sequence of characters, 64 characters at a time (AVX2 version).
+ * @param inChars The characters.
+ * @param inLength The number of characters.
+ * @param inByte The byte to search for.
+ * @return If the byte is found, then the function returns a pointer to its first occurrence.
+ * Otherwise, it returns the value NULL.
+ * @warning This function must only be called if the CPU supports AVX2 (see `_prepareFinder()`).
+ */
+
+__attribute__((target("avx2")))
+static const char *_findByteAVX2(const char *inChars, size_t inLength, unsigned char inByte) {
+    const __m256i needle = _mm256_set1_epi8((char)inByte);
+    size_t i = 0;
+    for (; i + 64 <= inLength; i += 64) {
+        __m256i low = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(inChars + i)), needle);
+        __m256i high = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(inChars + i + 32)), needle);
+        // Test both blocks at once: the (rare) match is located afterwards.
+        if (0 != _mm256_movemask_epi8(_mm256_or_si256(low, high))) {
+            unsigned mask = (unsigned)_mm256_movemask_epi8(low);
+            if (0 != mask) {
+                return inChars + i + __builtin_ctz(mask);
+            }
+            return inChars + i + 32 + __builtin_ctz((unsigned)_mm256_movemask_epi8(high));
+        }
+    }
+    for (; i + 32 <= inLength; i += 32) {
+        unsigned mask = (unsigned)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(inChars + i)), needle));
+        if (0 != mask) {
+            return inChars + i + __builtin_ctz(mask);
+        }
+    }
+    return _findByteSSE2(inChars + i, inLength - i, inByte);
+}
+
+#endif
+
+/**
+ * @brief Prepare a given delimiter for repeated searches.
+ *
+ * The search function is selected once: a single-byte delimiter is searched with SIMD instructions (AVX2 if the CPU
+ * supports it, SSE2 otherwise) on x86 platforms, and with `memchr()` on other platforms. A longer delimiter is searched
+ * with the Horspool algorithm, whose shift table is computed here.
+ * @param outFinder The structure used to store the prepared delimiter.
+ * @param inDelimiter The delimiter, as a zero terminated string of characters.
+ */
+
+static void _prepareFinder(struct CX_StringFinder *outFinder, const char *inDelimiter) {
+    outFinder->delimiter = (const unsigned char*)inDelimiter;
+    outFinder->length = strlen(inDelimiter);
+    outFinder->findByte = &_findByte;
+#ifdef CX_STRING_SIMD_X86
+    outFinder->findByte = __builtin_cpu_supports("avx2") ? &_findByteAVX2 : &_findByteSSE2;
+#endif
+    if (outFinder->length < 2) {
+        return;
+    }
+    for (size_t i = 0; i <= UCHAR_MAX; i++) {
+        outFinder->shift[i] = outFinder->length;
+    }
+    for (size_t i = 0; i < outFinder->length - 1; i++) {
+        outFinder->shift[outFinder->delimiter[i]] = outFinder->length - 1 - i;
+    }
+}
+
+/**
+ * @brief Search for a prepared delimiter within a sequence of characters.
+ * @param inFinder The prepared delimiter (see `_prepareFinder()`).
+ * @param inChars The characters.
+ * @param inLength The number of characters.
+ * @return If the delimiter is found, then the function returns a pointer to its first occurrence.
+ * Otherwise (or if the delimiter is empty), it returns the value NULL.
+ */
+
+static const char *_find(const struct CX_StringFinder *inFinder, const char *inChars, size_t inLength) {
+    size_t length = inFinder->length;
+    if (length < 2) {
+        return 0 == length ? NULL : inFinder->findByte(inChars, inLength, inFinder->delimiter[0]);
+    }
+    const unsigned char *chars = (const unsigned char*)inChars;
+    const unsigned char *delimiter = inFinder->delimiter;
+    unsigned char last = delimiter[length - 1];
+    for (size_t position = 0; position + length <= inLength; ) {
+        unsigned char c = chars[position + length - 1];
+        if (c == last && 0 == memcmp(chars + position, delimiter, length - 1)) {
+            return inChars + position;
+        }
+        position += inFinder->shift[c];
+    }
+    return NULL;
 }
 
 /**
  * @brief Split a String object into a list of String objects, using a zero terminated string of character to represent the
  * boundary.
+ *
+ * The delimiter is prepared once per call: a single-byte delimiter is searched with SIMD instructions (where
+ * available), and a longer delimiter is searched with the Horspool algorithm.
  * @param inString The String to split.
- * @param inDelimiter The boundary string, as a zero terminated string of character.
+ * @param inDelimiter The boundary string, as a zero terminated string of character. If it is empty, then the String
+ * object is not split.
  * @return Upon successful completion the function returns an ArrayString object.
  * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
  * @warning The returned ArrayString object has been **dynamically allocated**.
@@ -202,25 +512,26 @@ CX_ArrayString CX_StringSplitChar(CX_String inString, char* inDelimiter) {
     if (NULL == array) {
         return NULL;
     }
-    char *pool = *inString;
-    char *beginning = strstr(pool, inDelimiter);
-    while (NULL != beginning) {
-        unsigned long length = beginning - pool;
-        char *element = (char*)malloc(length + 1);
-        if (NULL == element) {
+    struct CX_StringFinder finder;
+    _prepareFinder(&finder, inDelimiter);
+    const char *source = NULL == *inString ? "" : *inString;
+    size_t length = NULL == *inString ? 0 : CX_StringLength(inString);
+    size_t offset = 0;
+    const char *beginning;
+    do {
+        beginning = _find(&finder, source + offset, length - offset);
+        size_t end = NULL == beginning ? length : (size_t)(beginning - source);
+        // The element is built in place: a short element costs a single allocation.
+        CX_String element = _create(source + offset, end - offset);
+        if (NULL == element || NULL == CX_ArrayAdd((CX_Array) array, element)) {
+            if (NULL != element) {
+                CX_StringDispose(element);
+            }
+            CX_ArrayStringDispose(array);
             return NULL;
         }
-        strncpy(element, pool, length);
-        element[length] = 0;
-        CX_ArrayStringAddCloneChar(array, element);
-        free(element);
-
-        pool = beginning + strlen(inDelimiter);
-        beginning = strstr(pool, inDelimiter);
-    }
-    if (strlen(pool) >= 0) {
-        CX_ArrayStringAddCloneChar(array, pool);
-    }
+        offset = end + finder.length;
+    } while (NULL != beginning);
 
     return array;
 }
@@ -243,8 +554,11 @@ CX_ArrayString CX_StringSplit(CX_String inString, CX_String inDelimiter) {
 /**
  * @brief Split a String object into a list of String objects, using a zero terminated string of characters to represent
  * the "regex boundary".
+ *
+ * The regex is compiled once, and then kept within the process-wide cache of regexes (see `CX_RegexGetCached()`).
  * @param inString The String object to split.
- * @param inRegex The zero terminated string of characters that represents the "regex boundary".
+ * @param inRegex The zero terminated string of characters that represents the "regex boundary". If it matches an empty
+ * string, then the String object is not split any further.
  * @param outStatus The Status object.
  * @return Upon successful completion the function returns an ArrayString object.
  * Otherwise, the function returns the value NULL.
@@ -255,47 +569,186 @@ CX_ArrayString CX_StringSplit(CX_String inString, CX_String inDelimiter) {
  */
 
 CX_ArrayString CX_StringSplitRegex(CX_String inString, char* inRegex, CX_Status outStatus) {
-    CX_StatusReset(outStatus);
-    regex_t re;
-    if (0 != regcomp(&re, inRegex, REG_EXTENDED)) {
-        CX_StatusSetError(outStatus, errno, "Cannot compile the regex \"%s\".", inRegex);
+    CX_Regex regex = CX_RegexGetCached(inRegex, REG_EXTENDED, outStatus);
+    if (NULL == regex) {
         return NULL;
     }
-    CX_ArrayString array = CX_ArrayStringCreate(NULL);
-    if (NULL == array) {
-        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+    CX_ArrayString array = CX_RegexSplit(regex, inString, outStatus);
+    CX_RegexDispose(regex);
+    return array;
+}
+
+/**
+ * @brief Create a SplitIndex object (see `CX_StringSplitCharIndex()`).
+ * @return Upon successful completion the function returns a new, empty, SplitIndex object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ * @warning Please keep in mind that the returned SplitIndex object has been **dynamically allocated**.
+ * You should free it with the function `CX_SplitIndexDispose()`.
+ * @note A SplitIndex object can be filled many times: its memory is reused.
+ */
+
+CX_SplitIndex CX_SplitIndexCreate() {
+    CX_SplitIndex index = (CX_SplitIndex)malloc(sizeof(struct CX_SplitIndexType));
+    if (NULL == index) {
+        return NULL;
+    }
+    index->tokens = CX_ArrayCreateInline(sizeof(CX_SplitToken), NULL);
+    if (NULL == index->tokens) {
+        free(index);
         return NULL;
     }
+    index->source = NULL;
+    return index;
+}
 
-    regmatch_t matches[1];
-    char *pool = *inString;
+/**
+ * @brief Free all the resources allocated for a given SplitIndex object.
+ * @param inIndex The SplitIndex object. The split string is not freed.
+ */
 
-    int status = regexec(&re, pool, 1, matches, 0);
-    while(0 == status) {
-        int start = matches[0].rm_so; // The first character of the match.
-        int stop = matches[0].rm_eo; // The first character that follows the match.
-        char *element = (char*)malloc(start+1);
-        if (NULL == element) {
-            CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
-            return NULL;
+void CX_SplitIndexDispose(CX_SplitIndex inIndex) {
+    CX_ArrayDispose(inIndex->tokens);
+    free(inIndex);
+}
+
+/**
+ * @brief Return the number of tokens in a given SplitIndex object.
+ * @param inIndex The SplitIndex object.
+ * @return The function returns the number of tokens.
+ */
+
+size_t CX_SplitIndexGetCount(CX_SplitIndex inIndex) {
+    return CX_ArrayGetCount(inIndex->tokens);
+}
+
+/**
+ * @brief Return the tokens of a given SplitIndex object.
+ * @param inIndex The SplitIndex object.
+ * @return The function returns a pointer to the first token (see `CX_SplitIndexGetCount()`). Each token gives the
+ * position and the length of a substring of the split string.
+ * @warning The returned pointer becomes invalid as soon as the SplitIndex object is filled again.
+ */
+
+CX_SplitToken *CX_SplitIndexGetTokens(CX_SplitIndex inIndex) {
+    return (CX_SplitToken*)CX_ArrayGetValues(inIndex->tokens);
+}
+
+/**
+ * @brief Create a String object that contains the characters of a given token of a given SplitIndex object.
+ * @param inIndex The SplitIndex object.
+ * @param inPosition The position of the token.
+ * @return Upon successful completion the function returns a new String object.
+ * Otherwise, the function returns the value NULL (which means that the position is not valid, or that the process ran
+ * out of memory).
+ * @warning Please keep in mind that the returned String object has been **dynamically allocated**.
+ * You should free it with the function `CX_StringDispose()`.
+ * @warning The split string must not have been modified (or freed) since the SplitIndex object has been filled.
+ */
+
+CX_String CX_SplitIndexGetStringAt(CX_SplitIndex inIndex, size_t inPosition) {
+    CX_SplitToken *token = (CX_SplitToken*)CX_ArrayGetValueAt(inIndex->tokens, inPosition);
+    if (NULL == token) {
+        return NULL;
+    }
+    return _create(inIndex->source + token->offset, token->length);
+}
+
+/**
+ * @brief Add a token at the end of a given SplitIndex object.
+ * @param inIndex The SplitIndex object.
+ * @param inOffset The position of the first character of the token.
+ * @param inLength The number of characters of the token.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory).
+ */
+
+static bool _addToken(CX_SplitIndex inIndex, size_t inOffset, size_t inLength) {
+    CX_SplitToken token = { inOffset, inLength };
+    return NULL != CX_ArrayAddValue(inIndex->tokens, &token);
+}
+
+/**
+ * @brief Prepare a given SplitIndex object to receive the tokens of a given String object.
+ * @param inIndex The SplitIndex object.
+ * @param inString The String object.
+ * @return Upon successful completion the function returns the characters of the String object (or an empty string, if
+ * the String object is empty). Otherwise, it returns the value NULL (which means that the process ran out of memory).
+ */
+
+static const char *_resetIndex(CX_SplitIndex inIndex, CX_String inString) {
+    if (! CX_ArrayTruncate(inIndex->tokens, 0)) {
+        return NULL;
+    }
+    inIndex->source = NULL == SL_StringGetString(inString) ? "" : SL_StringGetString(inString);
+    return inIndex->source;
+}
+
+/**
+ * @brief Split a String object, using a zero terminated string of characters to represent the boundary, and store the
+ * positions of the tokens into a given SplitIndex object.
+ *
+ * The tokens are the same as the tokens returned by `CX_StringSplitChar()`. However, their characters are not copied:
+ * the string is scanned once, and the only allocations are made when the SplitIndex object grows (no allocation at
+ * all if the SplitIndex object is reused, and if it is large enough).
+ * @param inString The String object to split. It must not be modified (or freed) while the tokens are used.
+ * @param inDelimiter The boundary, as a zero terminated string of characters. If it is empty, then the String object
+ * is not split.
+ * @param outIndex The SplitIndex object. Its previous tokens are removed.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory).
+ */
+
+bool CX_StringSplitCharIndex(CX_String inString, char *inDelimiter, CX_SplitIndex outIndex) {
+    const char *source = _resetIndex(outIndex, inString);
+    if (NULL == source) {
+        return false;
+    }
+    size_t length = NULL == SL_StringGetString(inString) ? 0 : CX_StringLength(inString);
+    struct CX_StringFinder finder;
+    _prepareFinder(&finder, inDelimiter);
+    size_t offset = 0;
+    const char *beginning;
+    while (NULL != (beginning = _find(&finder, source + offset, length - offset))) {
+        size_t position = (size_t)(beginning - source);
+        if (! _addToken(outIndex, offset, position - offset)) {
+            return false;
         }
-        strncpy(element, pool, start);
-        element[start] = 0;
-        CX_ArrayStringAddCloneChar(array, element);
-        free(element);
-        pool += stop;
-        status = regexec(&re, pool, 1, matches, 0);
+        offset = position + finder.length;
     }
-    regfree(&re);
-    if (strlen(pool) >= 0) {
-        CX_ArrayStringAddCloneChar(array, pool);
+    return _addToken(outIndex, offset, length - offset);
+}
+
+/**
+ * @brief Split a String object, using a regex to represent the boundary, and store the positions of the tokens into a
+ * given SplitIndex object.
+ *
+ * The tokens are the same as the tokens returned by `CX_StringSplitRegex()`, but their characters are not copied.
+ * The regex is taken from the process-wide cache of regexes (see `CX_RegexGetCached()`).
+ * @param inString The String object to split. It must not be modified (or freed) while the tokens are used.
+ * @param inRegex The zero terminated string of characters that represents the "regex boundary". If it matches an empty
+ * string, then the String object is not split any further.
+ * @param outIndex The SplitIndex object. Its previous tokens are removed.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the regex is not valid, or that the process ran out of
+ * memory).
+ */
+
+bool CX_StringSplitRegexIndex(CX_String inString, char *inRegex, CX_SplitIndex outIndex, CX_Status outStatus) {
+    CX_Regex regex = CX_RegexGetCached(inRegex, REG_EXTENDED, outStatus);
+    if (NULL == regex) {
+        return false;
     }
-    return array;
+    bool done = CX_RegexSplitIndex(regex, inString, outIndex, outStatus);
+    CX_RegexDispose(regex);
+    return done;
 }
 
 /**
  * @brief Replace a pattern represented by a regex by zero terminated string of characters within a given String object by a
  * given zero terminated string of characters.
+ *
+ * The regex is compiled once, and then kept within the process-wide cache of regexes (see `CX_RegexGetCached()`).
  * @param inString The String object that contains the pattern to replace.
  * @param inSearchRegex A zero terminated string of characters that represents the regex.
  * @param inReplacement A zero terminated string of characters that represents the replacement.
@@ -309,17 +762,12 @@ CX_ArrayString CX_StringSplitRegex(CX_String inString, char* inRegex, CX_Status
  */
 
 CX_String CX_StringReplaceRegexChar(CX_String inString, char* inSearchRegex, char *inReplacement, CX_Status outStatus) {
-    CX_StatusReset(outStatus);
-    CX_ArrayString array = CX_StringSplitRegex(inString, inSearchRegex, outStatus);
-    if (NULL == array) {
-        return NULL;
-    }
-    CX_String result = CX_ArrayStringJoinChar(array, inReplacement);
-    if (NULL == result) {
-        CX_StatusSetError(outStatus, errno, "Cannot allocate memory!");
+    CX_Regex regex = CX_RegexGetCached(inSearchRegex, REG_EXTENDED, outStatus);
+    if (NULL == regex) {
         return NULL;
     }
-    CX_ArrayStringDispose(array);
+    CX_String result = CX_RegexReplace(regex, inString, inReplacement, outStatus);
+    CX_RegexDispose(regex);
     return result;
 }
 
@@ -342,35 +790,6 @@ CX_String CX_StringReplaceRegex(CX_String inString, char* inSearchRegex, CX_Stri
     return CX_StringReplaceRegexChar(inString, inSearchRegex, SL_StringGetString(inReplacement), outStatus);
 }
 
-/**
- * @brief Free an element of an Array object
- * @param inElement The element to free.
- * @note This function is used by the function `CX_StringLinearizeChar()`.
- */
-
-static void _positionDisposer(void *inElement) {
-    free(inElement);
-}
-
-/**
- * @brief Clone an element of an Array object.
- * @param inElement The element to clone.
- * @param outStatus The Status object.
- * @return Upon successful completion, the function returns a newly allocated element.
- * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
- * @note This function is used by the function `CX_StringLinearizeChar()`.
- */
-
-static void *_positionCloner(void *inElement, CX_Status outStatus) {
-    int *element = (int*)malloc(sizeof(int));
-    if (NULL == element) {
-        CX_StatusSetError(outStatus, errno, "Cannot allocated memory!");
-        return NULL;
-    }
-    *element = *((int*)inElement);
-    return (void*)element;
-}
-
 /**
  * @brief Linearize a zero terminated string of characters and returns a newly allocated String object that represents the
  * linearized string.
@@ -406,7 +825,7 @@ CX_String CX_StringLinearizeChar(char *inString, bool *outLinearized) {
     }
 
     // The string needs to be linearized.
-    CX_Array array = CX_ArrayCreate(&_positionDisposer, &_positionCloner);
+    CX_Array array = CX_ArrayCreateInline(sizeof(unsigned long), NULL);
     if (NULL == array) {
         return NULL;
     }
@@ -437,14 +856,7 @@ CX_String CX_StringLinearizeChar(char *inString, bool *outLinearized) {
             }
         }
         if (found) {
-            unsigned long *position = (unsigned long*)malloc(sizeof(unsigned long));
-            if (NULL == position) {
-                CX_ArrayDispose(array);
-                free(preResult);
-                return NULL;
-            }
-            *position = currentPosition;
-            if (NULL == CX_ArrayAdd(array, (void *) position)) {
+            if (NULL == CX_ArrayAddValue(array, &currentPosition)) {
                 CX_ArrayDispose(array);
                 free(preResult);
                 return NULL;
@@ -465,7 +877,7 @@ CX_String CX_StringLinearizeChar(char *inString, bool *outLinearized) {
     }
     for (int i=0; i < CX_ArrayGetCount(array); i++) {
         char sep = i == (CX_ArrayGetCount(array) - 1) ? ':' : ',';
-        unsigned long *value = (unsigned long *) CX_ArrayGetElementAt(array, i);
+        unsigned long *value = (unsigned long *) CX_ArrayGetValueAt(array, i);
         sprintf(prefix + strlen(prefix), "%lu%c", *value, sep);
     }
     CX_ArrayDispose(array);
@@ -23,6 +23,13 @@ size_t CX_StringPrependFmt(CX_String inString, const char *inFmt, ...);
 CX_ArrayString CX_StringSplit(CX_String inString, CX_String inDelimiter);
 CX_ArrayString CX_StringSplitChar(CX_String inString, char* inDelimiter);
 CX_ArrayString CX_StringSplitRegex(CX_String inString, char* inRegex, CX_Status outStatus);
+CX_SplitIndex CX_SplitIndexCreate();
+void CX_SplitIndexDispose(CX_SplitIndex inIndex);
+size_t CX_SplitIndexGetCount(CX_SplitIndex inIndex);
+CX_SplitToken *CX_SplitIndexGetTokens(CX_SplitIndex inIndex);
+CX_String CX_SplitIndexGetStringAt(CX_SplitIndex inIndex, size_t inPosition);
+bool CX_StringSplitCharIndex(CX_String inString, char *inDelimiter, CX_SplitIndex outIndex);
+bool CX_StringSplitRegexIndex(CX_String inString, char *inRegex, CX_SplitIndex outIndex, CX_Status outStatus);
 CX_String CX_StringReplaceRegex(CX_String inString, char* inSearchRegex, CX_String inReplacement, CX_Status outStatus);
 CX_String CX_StringReplaceRegexChar(CX_String inString, char* inSearchRegex, char *inReplacement, CX_Status outStatus);
 CX_String CX_StringLinearize(CX_String inString, bool *outLinearized);
@@ -0,0 +1,306 @@
+/**
+ * @file
+ *
+ * @brief This file implements the StringBuilder object: a buffer used to build a string piece by piece.
+ *
+ * The characters are stored within a buffer that has free space at both ends. When one end is full, the characters
+ * are moved to the middle of the buffer (or to a new buffer twice as large), with free space at both ends. Thus,
+ * appending or prepending a piece of N characters costs O(N) amortized, no matter how long the string is. Building a
+ * string front to back with `CX_StringPrependChar()` costs O(N²) instead.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include "CX_String.h"
+#include "CX_StringBuilder.h"
+
+/*! \brief Minimum number of bytes allocated for the buffer of a StringBuilder object.
+ */
+
+#define CX_STRING_BUILDER_MIN_CAPACITY 64
+
+/**
+ * @brief Make sure that a given number of characters can be inserted at each end of a given StringBuilder object.
+ *
+ * If one end is full while the buffer is less than half full, then the characters are moved to the middle of the
+ * buffer. Otherwise, they are moved to a new buffer (at least) twice as large. In both cases, the free space that is
+ * not requested is shared between both ends.
+ * @param inBuilder The StringBuilder object.
+ * @param inFront The number of characters to insert at the beginning.
+ * @param inBack The number of characters to insert at the end.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the
+ * StringBuilder object is left untouched.
+ */
+
+static bool _reserve(CX_StringBuilder inBuilder, size_t inFront, size_t inBack) {
+    size_t back = inBuilder->capacity - inBuilder->front - inBuilder->length;
+    if (inFront <= inBuilder->front && inBack <= back) {
+        return true;
+    }
+    if (inFront > SIZE_MAX / 4 || inBack > SIZE_MAX / 4 || inBuilder->length > SIZE_MAX / 4) {
+        return false;
+    }
+    size_t needed = inFront + inBuilder->length + inBack;
+    if (needed <= inBuilder->capacity / 2) {
+        // Only one end is full: move the characters to the middle of the buffer.
+        size_t front = inFront + (inBuilder->capacity - needed) / 2;
+        memmove(inBuilder->buffer + front, inBuilder->buffer + inBuilder->front, inBuilder->length);
+        inBuilder->front = front;
+        return true;
+    }
+    size_t capacity = inBuilder->capacity < CX_STRING_BUILDER_MIN_CAPACITY ?
+            CX_STRING_BUILDER_MIN_CAPACITY : 2 * inBuilder->capacity;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+    char *buffer = (char*)malloc(capacity);
+    if (NULL == buffer) {
+        return false;
+    }
+    size_t front = inFront + (capacity - needed) / 2;
+    if (inBuilder->length > 0) {
+        memcpy(buffer + front, inBuilder->buffer + inBuilder->front, inBuilder->length);
+    }
+    free(inBuilder->buffer);
+    inBuilder->buffer = buffer;
+    inBuilder->capacity = capacity;
+    inBuilder->front = front;
+    return true;
+}
+
+/**
+ * @brief Create a new StringBuilder object.
+ * @param inCapacity The number of bytes to allocate for the buffer. The value 0 means that no buffer is allocated
+ * until characters are added.
+ * @return Upon successful completion the function returns a new StringBuilder object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory).
+ * @warning Please keep in mind that the returned StringBuilder object has been **dynamically allocated**.
+ * You should free it with the function `CX_StringBuilderDispose()`.
+ */
+
+CX_StringBuilder CX_StringBuilderCreate(size_t inCapacity) {
+    CX_StringBuilder builder = (CX_StringBuilder)malloc(sizeof(struct CX_StringBuilderType));
+    if (NULL == builder) {
+        return NULL;
+    }
+    builder->buffer = NULL;
+    builder->capacity = 0;
+    builder->front = 0;
+    builder->length = 0;
+    if (inCapacity > 0) {
+        builder->buffer = (char*)malloc(inCapacity);
+        if (NULL == builder->buffer) {
+            free(builder);
+            return NULL;
+        }
+        builder->capacity = inCapacity;
+        // The pieces may be appended or prepended: keep free space at both ends.
+        builder->front = inCapacity / 2;
+    }
+    return builder;
+}
+
+/**
+ * @brief Free all the resources allocated for a given StringBuilder object.
+ * @param inBuilder The StringBuilder object.
+ */
+
+void CX_StringBuilderDispose(CX_StringBuilder inBuilder) {
+    free(inBuilder->buffer);
+    free(inBuilder);
+}
+
+/**
+ * @brief Return the number of characters in a given StringBuilder object.
+ * @param inBuilder The StringBuilder object.
+ * @return The function returns the number of characters.
+ */
+
+size_t CX_StringBuilderGetLength(CX_StringBuilder inBuilder) {
+    return inBuilder->length;
+}
+
+/**
+ * @brief Return the characters of a given StringBuilder object.
+ * @param inBuilder The StringBuilder object.
+ * @return The function returns a pointer to the first character (or the value NULL if no buffer has been allocated).
+ * @warning The characters are **not** followed by a zero. The returned pointer becomes invalid as soon as characters
+ * are added to the StringBuilder object.
+ */
+
+const char *CX_StringBuilderGetChars(CX_StringBuilder inBuilder) {
+    return NULL == inBuilder->buffer ? NULL : inBuilder->buffer + inBuilder->front;
+}
+
+/**
+ * @brief Add a sequence of characters at the end of a given StringBuilder object.
+ * @param inBuilder The StringBuilder object.
+ * @param inChars The characters. They must not belong to the StringBuilder object.
+ * @param inLength The number of characters.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the
+ * StringBuilder object is left untouched.
+ * @note This operation costs O(inLength) amortized.
+ */
+
+bool CX_StringBuilderAppend(CX_StringBuilder inBuilder, const char *inChars, size_t inLength) {
+    if (0 == inLength) {
+        return true;
+    }
+    if (! _reserve(inBuilder, 0, inLength)) {
+        return false;
+    }
+    memcpy(inBuilder->buffer + inBuilder->front + inBuilder->length, inChars, inLength);
+    inBuilder->length += inLength;
+    return true;
+}
+
+/**
+ * @brief Add a zero terminated string of characters at the end of a given StringBuilder object.
+ * @param inBuilder The StringBuilder object.
+ * @param inString The zero terminated string of characters.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory).
+ */
+
+bool CX_StringBuilderAppendChar(CX_StringBuilder inBuilder, const char *inString) {
+    return CX_StringBuilderAppend(inBuilder, inString, strlen(inString));
+}
+
+/**
+ * @brief Add a String object at the end of a given StringBuilder object.
+ * @param inBuilder The StringBuilder object.
+ * @param inString The String object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory).
+ */
+
+bool CX_StringBuilderAppendString(CX_StringBuilder inBuilder, CX_String inString) {
+    return CX_StringBuilderAppend(inBuilder, SL_StringGetString(inString), CX_StringLength(inString));
+}
+
+/**
+ * @brief Add a sequence of characters at the beginning of a given StringBuilder object.
+ * @param inBuilder The StringBuilder object.
+ * @param inChars The characters. They must not belong to the StringBuilder object.
+ * @param inLength The number of characters.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory). In this case, the
+ * StringBuilder object is left untouched.
+ * @note This operation costs O(inLength) amortized.
+ */
+
+bool CX_StringBuilderPrepend(CX_StringBuilder inBuilder, const char *inChars, size_t inLength) {
+    if (0 == inLength) {
+        return true;
+    }
+    if (! _reserve(inBuilder, inLength, 0)) {
+        return false;
+    }
+    inBuilder->front -= inLength;
+    memcpy(inBuilder->buffer + inBuilder->front, inChars, inLength);
+    inBuilder->length += inLength;
+    return true;
+}
+
+/**
+ * @brief Add a zero terminated string of characters at the beginning of a given StringBuilder object.
+ * @param inBuilder The StringBuilder object.
+ * @param inString The zero terminated string of characters.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory).
+ */
+
+bool CX_StringBuilderPrependChar(CX_StringBuilder inBuilder, const char *inString) {
+    return CX_StringBuilderPrepend(inBuilder, inString, strlen(inString));
+}
+
+/**
+ * @brief Add a String object at the beginning of a given StringBuilder object.
+ * @param inBuilder The StringBuilder object.
+ * @param inString The String object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false (which means that the process ran out of memory).
+ */
+
+bool CX_StringBuilderPrependString(CX_StringBuilder inBuilder, CX_String inString) {
+    return CX_StringBuilderPrepend(inBuilder, SL_StringGetString(inString), CX_StringLength(inString));
+}
+
+/**
+ * @brief Remove all the characters from a given StringBuilder object. The buffer is kept.
+ * @param inBuilder The StringBuilder object.
+ */
+
+void CX_StringBuilderClear(CX_StringBuilder inBuilder) {
+    inBuilder->front = inBuilder->capacity / 2;
+    inBuilder->length = 0;
+}
+
+/**
+ * @brief Turn the characters of a given StringBuilder object into a String object.
+ *
+ * The buffer of the StringBuilder object is handed over to the String object: the characters are moved to the
+ * beginning of the buffer, but they are not copied into a new buffer. Then, the StringBuilder object is empty, and it
+ * can be used to build another string.
+ * @param inBuilder The StringBuilder object.
+ * @return Upon successful completion the function returns a new String object.
+ * Otherwise, the function returns the value NULL (which means that the process ran out of memory). In this case, the
+ * StringBuilder object is left untouched.
+ * @warning Please keep in mind that the returned String object has been **dynamically allocated**.
+ * You should free it with the function `CX_StringDispose()`.
+ */
+
+CX_String CX_StringBuilderFinish(CX_StringBuilder inBuilder) {
+    if (0 == inBuilder->length) {
+        return CX_StringCreate("");
+    }
+    struct CX_StringType *header = (struct CX_StringType*)malloc(sizeof(struct CX_StringType));
+    if (NULL == header || ! _reserve(inBuilder, 0, 1)) {
+        free(header);
+        return NULL;
+    }
+    memmove(inBuilder->buffer, inBuilder->buffer + inBuilder->front, inBuilder->length);
+    inBuilder->buffer[inBuilder->length] = 0;
+    header->string = inBuilder->buffer;
+    header->length = inBuilder->length;
+    header->capacity = inBuilder->capacity;
+    inBuilder->buffer = NULL;
+    inBuilder->capacity = 0;
+    inBuilder->front = 0;
+    inBuilder->length = 0;
+    return &header->string;
+}
+
+/**
+ * @brief Write the characters of a given StringBuilder object to a given file descriptor.
+ *
+ * The characters are written as they are stored: the string is not flattened into a new buffer.
+ * @param inBuilder The StringBuilder object.
+ * @param inFileDescriptor The file descriptor.
+ * @param outStatus The Status object.
+ * @return Upon successful completion the function returns the value true.
+ * Otherwise, it returns the value false. In this case, some characters may have been written.
+ */
+
+bool CX_StringBuilderWrite(CX_StringBuilder inBuilder, int inFileDescriptor, CX_Status outStatus) {
+    CX_StatusReset(outStatus);
+    size_t written = 0;
+    while (written < inBuilder->length) {
+        ssize_t count = write(inFileDescriptor, inBuilder->buffer + inBuilder->front + written,
+                              inBuilder->length - written);
+        if (count < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            CX_StatusSetError(outStatus, errno, "Cannot write to the file descriptor %d: %m", inFileDescriptor);
+            return false;
+        }
+        written += (size_t)count;
+    }
+    return true;
+}
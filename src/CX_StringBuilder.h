@@ -0,0 +1,22 @@
+#ifndef CX_LIB_CX_STRINGBUILDER_H
+#define CX_LIB_CX_STRINGBUILDER_H
+
+#include <stdbool.h>
+#include "CX_Types.h"
+#include "CX_Status.h"
+
+CX_StringBuilder CX_StringBuilderCreate(size_t inCapacity);
+void CX_StringBuilderDispose(CX_StringBuilder inBuilder);
+size_t CX_StringBuilderGetLength(CX_StringBuilder inBuilder);
+const char *CX_StringBuilderGetChars(CX_StringBuilder inBuilder);
+bool CX_StringBuilderAppend(CX_StringBuilder inBuilder, const char *inChars, size_t inLength);
+bool CX_StringBuilderAppendChar(CX_StringBuilder inBuilder, const char *inString);
+bool CX_StringBuilderAppendString(CX_StringBuilder inBuilder, CX_String inString);
+bool CX_StringBuilderPrepend(CX_StringBuilder inBuilder, const char *inChars, size_t inLength);
+bool CX_StringBuilderPrependChar(CX_StringBuilder inBuilder, const char *inString);
+bool CX_StringBuilderPrependString(CX_StringBuilder inBuilder, CX_String inString);
+void CX_StringBuilderClear(CX_StringBuilder inBuilder);
+CX_String CX_StringBuilderFinish(CX_StringBuilder inBuilder);
+bool CX_StringBuilderWrite(CX_StringBuilder inBuilder, int inFileDescriptor, CX_Status outStatus);
+
+#endif //CX_LIB_CX_STRINGBUILDER_H
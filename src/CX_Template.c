@@ -31,6 +31,12 @@
 #include <regex.h>
 #include <string.h>
 #include "CX_Template.h"
+#include "CX_Regex.h"
+
+/*! \brief The regex that matches a tag within a template.
+ */
+
+#define CX_TEMPLATE_TAG_REGEX "(\\{[a-z_-]+\\})"
 
 /**
  * @brief Create a template.
@@ -96,28 +102,32 @@ void CX_TemplateReset(CX_Template inTemplate) {
 
 char *CX_TemplateProcess(CX_Template inTemplate, CX_BasicDictionary inDictionary) {
     CX_TemplateReset(inTemplate);
-    regex_t re;
-
-    if (0 != regcomp(&re, "(\\{[a-z_-]+\\})", REG_ICASE|REG_EXTENDED)) {
+    // The regex is compiled once, and then taken from the cache.
+    CX_Status regexStatus = CX_StatusCreate();
+    if (NULL == regexStatus) {
+        return NULL;
+    }
+    CX_Regex regex = CX_RegexGetCached(CX_TEMPLATE_TAG_REGEX, REG_ICASE|REG_EXTENDED, regexStatus);
+    CX_StatusDispose(regexStatus);
+    if (NULL == regex) {
         return NULL;
     }
 
-    regmatch_t matches[2];
+    size_t match_start, match_stop;
     int last_start = 0;
     int total_length = 0;
     char *pool = inTemplate->templateSpecification;
 
-    int status = regexec(&re, pool, 2, matches, 0);
-
-    while(0 == status) {
-        int start = matches[0].rm_so;
-        int stop = matches[0].rm_eo;
+    while(CX_RegexMatch(regex, pool, &match_start, &match_stop)) {
+        int start = (int)match_start;
+        int stop = (int)match_stop;
         int before_length = start - last_start;
 
         // Get the tag.
         int tag_length = stop - start - 2;
         char *tag = (char*)malloc(tag_length + 1);
         if (NULL == tag) {
+            CX_RegexDispose(regex);
             return NULL;
         }
         strncpy(tag, pool + start + 1, tag_length);
@@ -128,7 +138,7 @@ char *CX_TemplateProcess(CX_Template inTemplate, CX_BasicDictionary inDictionary
         free(tag);
         if (NULL == value) {
             // We did not find the tag.
-            regfree(&re);
+            CX_RegexDispose(regex);
             return NULL;
         }
 
@@ -136,6 +146,7 @@ char *CX_TemplateProcess(CX_Template inTemplate, CX_BasicDictionary inDictionary
         if (before_length > 0) {
             inTemplate->_result = (char*)realloc(inTemplate->_result, total_length + before_length);
             if (NULL == inTemplate->_result) {
+                CX_RegexDispose(regex);
                 return NULL;
             }
             strncpy(inTemplate->_result + total_length, pool, before_length);
@@ -145,13 +156,13 @@ char *CX_TemplateProcess(CX_Template inTemplate, CX_BasicDictionary inDictionary
         // Copy the value.
         inTemplate->_result = (char*)realloc(inTemplate->_result, total_length + tag_length);
         if (NULL == inTemplate->_result) {
+            CX_RegexDispose(regex);
             return NULL;
         }
         strncpy(inTemplate->_result + total_length, value, strlen(value));
         total_length += strlen(value);
 
         pool += stop;
-        status = regexec(&re, pool, 1, matches, 0);
     }
 
     // Treat the end of the string.
@@ -159,6 +170,7 @@ char *CX_TemplateProcess(CX_Template inTemplate, CX_BasicDictionary inDictionary
     if (reminder_length > 0) {
         inTemplate->_result = (char*)realloc(inTemplate->_result, total_length + reminder_length);
         if (NULL == inTemplate->_result) {
+            CX_RegexDispose(regex);
             return NULL;
         }
         strncpy(inTemplate->_result + total_length, pool, reminder_length);
@@ -168,9 +180,10 @@ char *CX_TemplateProcess(CX_Template inTemplate, CX_BasicDictionary inDictionary
     // Add a terminal zero.
     inTemplate->_result = (char*)realloc(inTemplate->_result, total_length + 1);
     if (NULL == inTemplate->_result) {
+        CX_RegexDispose(regex);
         return NULL;
     }
     inTemplate->_result[total_length] = 0;
-    regfree(&re);
+    CX_RegexDispose(regex);
     return inTemplate->_result;
 }
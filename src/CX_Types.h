@@ -8,6 +8,8 @@
 #define CX_LIB_CX_TYPES_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <regex.h>
 
 /**
  * @brief The Status object container.
@@ -31,15 +33,81 @@ struct CX_StatusType {
 
 typedef struct CX_StatusType *CX_Status;
 
+/*! \brief Number of pointers stored within the Array container itself, before a buffer is allocated.
+ */
+
+#define CX_ARRAY_SMALL_CAPACITY 4
+
 /**
  * @brief The Array container
  */
 
 struct CX_ArrayType {
     void **elements;
-    unsigned int count;
+    size_t count;
+    /**
+     * The number of elements that can be stored without reallocating the buffer `elements`.
+     * It is always greater than, or equal to, `count`.
+     */
+    size_t capacity;
+    /**
+     * The size, in bytes, of an element stored by value (see `CX_ArrayCreateInline()`).
+     * The value 0 means that the Array object stores pointers to elements.
+     */
+    size_t elementSize;
+    /**
+     * The number of free slots that precede the first element within the allocated buffer (see
+     * `CX_ArrayCreateDeque()`). The allocated buffer starts `front` slots before `elements`.
+     */
+    size_t front;
+    /**
+     * If the value of this field is true, then the elements can be inserted (or removed) at both ends of the Array
+     * object in O(1) amortized time (see `CX_ArrayCreateDeque()`).
+     */
+    bool deque;
+    /**
+     * If the buffer `elements` has been mapped (see `CX_ArraySetHugePageThreshold()`), then this field contains the
+     * size of the mapping, in bytes. Otherwise, it contains the value 0 (the buffer has been allocated by `malloc()`).
+     */
+    size_t mapped;
+    /**
+     * The size, in bytes, above which the buffer `elements` is mapped and backed by huge pages.
+     * The value 0 means that the buffer is always allocated by `malloc()`.
+     */
+    size_t hugePageThreshold;
     void(*elementDisposer)(void*);
     void*(*elementCloner)(void*, CX_Status);
+    /**
+     * If the value of this field is true, then `CX_ArrayDup()` does not clone the elements: the clone shares the
+     * buffer `elements` with the original Array object (see `CX_ArraySetCopyOnWrite()`).
+     */
+    bool copyOnWrite;
+    /**
+     * The number of Array objects that share the buffer `elements`.
+     * The value NULL means that the buffer is not shared.
+     */
+    unsigned int *shared;
+    /**
+     * The last chunk of memory allocated by `CX_ArrayAllocElement()` (see `CX_ArrayCreateArena()`).
+     * The value NULL means that no chunk has been allocated.
+     */
+    struct CX_ArrayArenaChunk *arena;
+    /**
+     * The segmented storage used by `CX_ArrayConcurrentAdd()` (see `CX_ArrayCreateConcurrent()`).
+     * The value NULL means that the Array object is not a concurrent Array object.
+     */
+    struct CX_ArrayConcurrentStore *concurrent;
+    /**
+     * The binary image the elements have been loaded from (see `CX_ArrayLoadInlineMapped()` and
+     * `CX_ArrayLoadRecordsMapped()`). The value NULL means that the Array object has not been loaded from an image.
+     */
+    struct CX_ArrayImage *image;
+    /**
+     * The buffer used to store the elements of a small Array object, so that no buffer has to be allocated: while the
+     * elements fit into it, `elements` points to it. It is used by the Array objects which elements are pointers (or
+     * values that are not larger than a pointer), except deques.
+     */
+    void *small[CX_ARRAY_SMALL_CAPACITY];
 };
 
 /**
@@ -48,12 +116,110 @@ struct CX_ArrayType {
 
 typedef struct CX_ArrayType *CX_Array;
 
+/**
+ * @brief The descriptor of a record loaded from a binary image (see `CX_ArrayLoadRecordsMapped()`).
+ *
+ * Its layout is the layout of the first fields of the String object container (see `struct CX_StringType`). Thus, the
+ * records of an image of strings are String objects.
+ */
+
+struct CX_ArrayRecordType {
+    /**
+     * The data of the record, followed by a zero.
+     */
+    void *data;
+    /**
+     * The length of the data, in bytes (excluding the terminating zero).
+     */
+    size_t length;
+    /**
+     * Always 0: the data belongs to the image.
+     */
+    size_t capacity;
+};
+
 /**
  * @brief The ArrayString object.
  */
 
 typedef CX_Array CX_ArrayString;
 
+/**
+ * @brief The ArrayFilterIterator object: it yields, one by one, the elements of an Array object that match a given
+ * predicate (see `CX_ArrayFilterIteratorInit()`).
+ *
+ * Unlike the other objects of the library, this object is not dynamically allocated: it is allocated by the caller
+ * (typically on the stack).
+ */
+
+typedef struct CX_ArrayFilterIteratorType {
+    CX_Array array;
+    bool(*keep)(void*, void*);
+    void *context;
+    /**
+     * The position of the next element to examine.
+     */
+    size_t next;
+} CX_ArrayFilterIterator;
+
+/**
+ * @brief The Heap object container: a binary heap (or priority queue) which elements are stored within an Array
+ * object.
+ */
+
+struct CX_HeapType {
+    /**
+     * The elements, in heap order: no element precedes its parent.
+     */
+    CX_Array array;
+    /**
+     * The function used to compare two elements: `compare(a, b, context) < 0` means that `a` must be popped before `b`.
+     */
+    int(*compare)(void*, void*, void*);
+    void *context;
+    /**
+     * The function called whenever an element is moved within the heap (see `CX_HeapSetPositionTracker()`).
+     * The value NULL means that the positions of the elements are not tracked.
+     */
+    void(*moved)(void*, size_t, void*);
+};
+
+/**
+ * @brief The Heap object.
+ */
+
+typedef struct CX_HeapType *CX_Heap;
+
+/**
+ * @brief The Ring object container: a FIFO queue of elements stored within a circular buffer.
+ */
+
+struct CX_RingType {
+    /**
+     * The circular buffer. Its number of slots is a power of two.
+     */
+    void **elements;
+    size_t capacity;
+    /**
+     * The position of the oldest element within the buffer.
+     */
+    size_t head;
+    size_t count;
+    /**
+     * If the value of this field is true, then the buffer is enlarged when it is full. Otherwise, no element can be
+     * added to a full Ring object.
+     */
+    bool growable;
+    void(*elementDisposer)(void*);
+    void*(*elementCloner)(void*, CX_Status);
+};
+
+/**
+ * @brief The Ring object.
+ */
+
+typedef struct CX_RingType *CX_Ring;
+
 /**
  * @brief The BasicDictionaryEntry object container.
  */
@@ -123,12 +289,139 @@ struct CX_LoggerType {
 
 typedef struct CX_LoggerType *CX_Logger;
 
+/*! \brief Number of bytes stored within the String container itself, before a buffer is allocated.
+ */
+
+#define CX_STRING_SMALL_CAPACITY 24
+
+/**
+ * @brief The String object container.
+ *
+ * A String object points to the first field of its container. Thus, `*s` (see `SL_StringGetString()`) is the zero
+ * terminated string of characters, and its length and capacity are stored right after it.
+ */
+
+struct CX_StringType {
+    /**
+     * The zero terminated string of characters. The value NULL means that the String object is empty.
+     */
+    char *string;
+    /**
+     * The number of characters (excluding the terminating zero).
+     */
+    size_t length;
+    /**
+     * The number of bytes allocated for `string`. The value 0 means that `string` is NULL, or that it does not belong
+     * to the String object (see `CX_ArrayStringLoadMapped()`): it is copied before it is modified.
+     */
+    size_t capacity;
+    /**
+     * The buffer used to store a short string, so that no buffer has to be allocated: while the string (and its
+     * terminating zero) fits into it, `string` points to it.
+     */
+    char small[CX_STRING_SMALL_CAPACITY];
+};
+
 /**
- * @brief The String object.
+ * @brief The String object (a pointer to the first field of a `struct CX_StringType`).
  */
 
 typedef char** CX_String;
 
+/**
+ * @brief A token found within a string by a split function (see `CX_StringSplitCharIndex()`).
+ */
+
+typedef struct CX_SplitTokenType {
+    /**
+     * The position of the first character of the token within the string.
+     */
+    size_t offset;
+    /**
+     * The number of characters of the token.
+     */
+    size_t length;
+} CX_SplitToken;
+
+/**
+ * @brief The SplitIndex object container: the positions of the tokens of a split string. The characters of the tokens
+ * are not copied.
+ */
+
+struct CX_SplitIndexType {
+    /**
+     * The split string. It belongs to the caller.
+     */
+    const char *source;
+    /**
+     * The tokens, in order (an inline Array object which values are `CX_SplitToken`).
+     */
+    CX_Array tokens;
+};
+
+/**
+ * @brief The SplitIndex object.
+ */
+
+typedef struct CX_SplitIndexType *CX_SplitIndex;
+
+/**
+ * @brief The Regex object container: a compiled regex, shared by reference counting (see `CX_RegexGetCached()`).
+ */
+
+struct CX_RegexType {
+    regex_t compiled;
+    /**
+     * The source of the regex (zero terminated string of characters).
+     */
+    char *pattern;
+    /**
+     * The flags given to `regcomp()`.
+     */
+    int flags;
+    /**
+     * A hash of the pattern and of the flags, used to speed up the cache lookups.
+     */
+    size_t hash;
+    /**
+     * The number of references to the Regex object (its owners, and the cache).
+     */
+    unsigned int references;
+};
+
+/**
+ * @brief The Regex object.
+ */
+
+typedef struct CX_RegexType *CX_Regex;
+
+/**
+ * @brief The StringBuilder object container: a buffer with free space at both ends, so that characters can be
+ * appended and prepended in O(1) amortized time.
+ */
+
+struct CX_StringBuilderType {
+    char *buffer;
+    /**
+     * The number of bytes allocated for `buffer`.
+     */
+    size_t capacity;
+    /**
+     * The position of the first character within `buffer`.
+     */
+    size_t front;
+    /**
+     * The number of characters.
+     */
+    size_t length;
+};
+
+/**
+ * @brief The StringBuilder object.
+ */
+
+typedef struct CX_StringBuilderType *CX_StringBuilder;
+
 /**
  * @brief The Template object container.
  */
@@ -163,6 +456,15 @@ enum CX_ObjectRefType {CX_MemRefPtr = 1, CX_MemRefPtrPtr = 0};
 
 typedef void(*CX_ObjectDisposer)(void*);
 
+/**
+ * @brief Pointer to a function executed by the parallel algorithms (see `CX_ParallelRun()`).
+ *
+ * The signature of the function must be: `void the_function(unsigned int index, unsigned int count, void *context)`
+ * Where `index` is the index of the task (between 0 and `count - 1`) and `count` the total number of tasks.
+ */
+
+typedef void(*CX_ParallelTask)(unsigned int, unsigned int, void*);
+
 /**
  * @brief This structure defines an object.
  *
@@ -11,6 +11,7 @@
 #include <stdio.h>
 
 #include "CX_Constants.h"
+#include "CX_Regex.h"
 
 /**
  *  @brief The maximum number of characters for the buffer used to store the environmental configuration for the
@@ -214,3 +215,12 @@ char *_CX_UTestGetMCheckConfiguration(const char *inFileBasename) {
     snprintf(_MCHECK_CONFIGURATION, CX_UTEST_MAX_MCHECK_CONF_SIZE, "MALLOC_TRACE=%s", path);
     return _MCHECK_CONFIGURATION;
 }
+
+/**
+ * @brief Release the caches shared by the whole process.
+ * @note You should not call the function below directly. Use "CX_UTEST_END_TEST()".
+ */
+
+void _CX_UTestReleaseCaches(void) {
+    CX_RegexCacheClear();
+}
@@ -27,6 +27,8 @@ char *_CX_UTestGetMCheckConfiguration(const char *inFileBasename);
 bool _CX_UTestIsCurrentCondition(char *inAbsoluteFilePath, char *inFunctionName, int inTestId);
 // You should not call the function below directly. Use "CX_UTEST_SET_CONDITION_ID()".
 void _CX_UTestSetConditionID(int inTestId);
+// You should not call the function below directly. Use "CX_UTEST_END_TEST()".
+void _CX_UTestReleaseCaches(void);
 
 const char *_CX_UTestGetMCheckReportFileAbsolutePath(const char *inFileBasename);
 
@@ -70,6 +72,19 @@ const char *_CX_UTestGetMCheckReportFileAbsolutePath(const char *inFileBasename)
     printf("Exec %s\n", __FUNCTION__); fflush(stdout); \
     CX_BashColorReset();
 
+/**
+ * @brief End a unit test that traces the memory allocations (with `mtrace()`).
+ *
+ * The caches shared by the whole process (see `CX_RegexGetCached()`) are released before the trace is stopped.
+ * Otherwise, their entries would be reported as memory leaks.
+ * @note This macro should be called, instead of `muntrace()`, at the end of each function that implements a unit test
+ * for a function that uses these caches.
+ */
+
+#define CX_UTEST_END_TEST() \
+    _CX_UTestReleaseCaches(); \
+    muntrace()
+
 /**
  * @brief End a unit tests suite.
  * @note This macro should be called once at the end of the file that implements a list of unit tests (for a given
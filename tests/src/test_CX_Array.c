@@ -1,5 +1,8 @@
 #include <mcheck.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
 #include "CUnit/CUnit.h"
 #include "CUnit/Basic.h"
 #include "CX_UTest.h"
@@ -40,6 +43,33 @@ bool elementSearch2(void *inElement) {
     return *((int*)inElement) < -1024 ? true : false;
 }
 
+bool elementSearchModulo(void *inElement, void *inContext) {
+    return 0 == *((int*)inElement) % *((int*)inContext);
+}
+
+int elementCompare(void *inA, void *inB, void *inContext) {
+    int a = *((int*)inA);
+    int b = *((int*)inB);
+    int direction = NULL == inContext ? 1 : *((int*)inContext);
+    return direction * (a < b ? -1 : (a > b ? 1 : 0));
+}
+
+/**
+ * Fill a buffer with integers: random values, many duplicates, sorted values or reverse sorted values.
+ */
+
+void fillIntegers(int *outValues, int inCount, int inKind) {
+    srand(inCount + inKind);
+    for (int i = 0; i < inCount; i++) {
+        switch (inKind) {
+            case 0: outValues[i] = rand(); break;
+            case 1: outValues[i] = rand() % 5; break;
+            case 2: outValues[i] = i; break;
+            default: outValues[i] = inCount - i;
+        }
+    }
+}
+
 void bigBuffer() {
     for(int i=0; i<3; i++) {
         char *buff = (char *) malloc(BIG_BUFFER_LENGTH);
@@ -501,6 +531,1680 @@ void test_CX_ArrayReplaceAt() {
     muntrace();
 }
 
+void test_CX_ArrayReserve() {
+    CX_UTEST_INIT_TEST("CX_ArrayReserve");
+    mtrace();
+
+    for(int i=0; i<5; i++) {
+        bigBuffer();
+        CX_Status status = CX_StatusCreate();
+        char *data = "ABCD";
+
+        CX_Array array = CX_ArrayCreate(NULL, &elementCloner);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(array), 0);
+
+        CU_ASSERT_TRUE_FATAL(CX_ArrayReserve(array, 1000, status));
+        CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(array), 1000);
+        void **elements = CX_ArrayGetElements(array);
+        for (int j = 0; j < 1000; j++) {
+            CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, data + j % 4));
+        }
+        // The buffer must not have been reallocated.
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElements(array), elements);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 1000);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(array), 1000);
+
+        // Reserving less than the current capacity does nothing.
+        CU_ASSERT_TRUE_FATAL(CX_ArrayReserve(array, 10, status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(array), 1000);
+
+        // The capacity grows geometrically.
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, data));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(array), 2000);
+        for (int j = 0; j < 1001; j++) {
+            CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(array, j), data + j % 4);
+        }
+
+        CX_ArrayDispose(array);
+        CX_StatusDispose(status);
+    }
+    muntrace();
+}
+
+void test_CX_ArrayShrinkToFit() {
+    CX_UTEST_INIT_TEST("CX_ArrayShrinkToFit");
+    mtrace();
+
+    for(int i=0; i<5; i++) {
+        bigBuffer();
+        CX_Status status = CX_StatusCreate();
+        int *element;
+
+        CX_Array array = CX_ArrayCreate(&elementDisposer, &elementCloner);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+        for (int j = 0; j < 10; j++) {
+            element = (int *) malloc(sizeof(int));
+            *element = j;
+            CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, element));
+        }
+        CU_ASSERT_TRUE_FATAL(CX_ArrayGetCapacity(array) >= 10);
+
+        // Removing elements does not reduce the capacity.
+        unsigned int capacity = CX_ArrayGetCapacity(array);
+        for (int j = 0; j < 7; j++) {
+            CX_ArrayRemove(array, 0, true, status);
+            CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+        }
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 3);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(array), capacity);
+
+        CU_ASSERT_TRUE_FATAL(CX_ArrayShrinkToFit(array, status));
+        CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(array), 3);
+        CU_ASSERT_EQUAL_FATAL(*((int *) CX_ArrayGetElementAt(array, 0)), 7);
+        CU_ASSERT_EQUAL_FATAL(*((int *) CX_ArrayGetElementAt(array, 1)), 8);
+        CU_ASSERT_EQUAL_FATAL(*((int *) CX_ArrayGetElementAt(array, 2)), 9);
+
+        // Shrink an empty array.
+        for (int j = 0; j < 3; j++) {
+            CX_ArrayRemove(array, 0, true, status);
+        }
+        CU_ASSERT_TRUE_FATAL(CX_ArrayShrinkToFit(array, status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(array), 0);
+        CU_ASSERT_PTR_NULL_FATAL(CX_ArrayGetElements(array));
+
+        CX_ArrayDispose(array);
+        CX_StatusDispose(status);
+    }
+    muntrace();
+}
+
+void test_CX_ArrayCreateInline() {
+    CX_UTEST_INIT_TEST("CX_ArrayCreateInline");
+    mtrace();
+
+    for(int i=0; i<5; i++) {
+        bigBuffer();
+        CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementSize(array), sizeof(int));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 0);
+        CX_ArrayDispose(array);
+
+        array = CX_ArrayCreateInline(0, NULL);
+        CU_ASSERT_PTR_NULL_FATAL(array);
+
+        array = CX_ArrayCreate(NULL, NULL);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementSize(array), 0);
+        CX_ArrayDispose(array);
+    }
+    muntrace();
+}
+
+void test_CX_ArrayInlinePointerFunctions() {
+    CX_UTEST_INIT_TEST("CX_ArrayAdd");
+    mtrace();
+
+    // The functions that manipulate pointers must not be used with an inline Array object.
+    CX_Status status = CX_StatusCreate();
+    CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+    int value = 10;
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayAdd(array, &value));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 0);
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayPushFront(array, &value));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 0);
+
+    CX_ArrayAddValue(array, &value);
+    CX_ArrayAddValue(array, &value);
+
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayInsertAt(array, &value, 0, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_FALSE_FATAL(CX_ArrayReplaceAt(array, &value, 0, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayRemove(array, 0, false, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArraySwapRemove(array, 0, false, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArraySearch(array, &elementSearch1, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+
+    // The Array object is left untouched.
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 2);
+    CU_ASSERT_EQUAL_FATAL(((int*)CX_ArrayGetValues(array))[0], 10);
+    CU_ASSERT_EQUAL_FATAL(((int*)CX_ArrayGetValues(array))[1], 10);
+
+    CX_ArrayDispose(array);
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_ArrayPointerValueFunctions() {
+    CX_UTEST_INIT_TEST("CX_ArrayAddValue");
+    mtrace();
+
+    // The functions that manipulate values must not be used with an Array object that stores pointers.
+    CX_Status status = CX_StatusCreate();
+    CX_Array array = CX_ArrayCreate(&elementDisposer, &elementCloner);
+    int value = 10;
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayAddValue(array, &value));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 0);
+
+    for (int i = 0; i < 2; i++) {
+        int *element = (int *) malloc(sizeof(int));
+        *element = i;
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, element));
+    }
+
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayGetValueAt(array, 0));
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayInsertValueAt(array, &value, 0, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_FALSE_FATAL(CX_ArrayReplaceValueAt(array, &value, 0, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_FALSE_FATAL(CX_ArrayRemoveValue(array, 0, NULL, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_FALSE_FATAL(CX_ArrayRemoveValue(array, 0, &value, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_FALSE_FATAL(CX_ArraySwapRemoveValue(array, 0, NULL, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_FALSE_FATAL(CX_ArraySwapRemoveValue(array, 0, &value, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArraySearchValues(array, &elementSearch1, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+
+    // The Array object is left untouched.
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 2);
+    CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(array, 0), 0);
+    CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(array, 1), 1);
+
+    CX_ArrayDispose(array);
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_ArrayAddValue() {
+    CX_UTEST_INIT_TEST("CX_ArrayAddValue");
+    mtrace();
+
+    for(int i=0; i<5; i++) {
+        bigBuffer();
+        CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+        for (int j = 0; j < 100; j++) {
+            int *v = (int *) CX_ArrayAddValue(array, &j);
+            CU_ASSERT_PTR_NOT_NULL_FATAL(v);
+            CU_ASSERT_EQUAL_FATAL(*v, j);
+            CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), j + 1);
+        }
+        int *values = (int *) CX_ArrayGetValues(array);
+        for (int j = 0; j < 100; j++) {
+            CU_ASSERT_EQUAL_FATAL(values[j], j);
+            CU_ASSERT_EQUAL_FATAL(*((int *) CX_ArrayGetValueAt(array, j)), j);
+            CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(array, j), CX_ArrayGetValueAt(array, j));
+        }
+        CU_ASSERT_PTR_NULL_FATAL(CX_ArrayGetValueAt(array, 100));
+        CX_ArrayDispose(array);
+    }
+    muntrace();
+}
+
+void test_CX_ArrayInsertValueAt() {
+    CX_UTEST_INIT_TEST("CX_ArrayInsertValueAt");
+    mtrace();
+
+    for(int i=0; i<5; i++) {
+        bigBuffer();
+        CX_Status status = CX_StatusCreate();
+        CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+        for (int j = 0; j < 5; j++) {
+            CX_ArrayAddValue(array, &j);
+        }
+        int v = 100;
+        int *rv = (int *) CX_ArrayInsertValueAt(array, &v, 4, status);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(rv);
+        CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+        CU_ASSERT_EQUAL_FATAL(*rv, 100);
+        v = 200;
+        rv = (int *) CX_ArrayInsertValueAt(array, &v, 0, status);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(rv);
+
+        int expected[] = {200, 0, 1, 2, 3, 100, 4};
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 7);
+        for (int j = 0; j < 7; j++) {
+            CU_ASSERT_EQUAL_FATAL(((int *) CX_ArrayGetValues(array))[j], expected[j]);
+        }
+
+        rv = (int *) CX_ArrayInsertValueAt(array, &v, 7, status);
+        CU_ASSERT_PTR_NULL_FATAL(rv);
+        CU_ASSERT_FALSE(CX_StatusIsSuccess(status));
+
+        CX_ArrayDispose(array);
+        CX_StatusDispose(status);
+    }
+    muntrace();
+}
+
+static int valueDisposerCalls = 0;
+
+void valueDisposer(void *inValue) {
+    valueDisposerCalls += *((int*)inValue);
+}
+
+void test_CX_ArrayRemoveValue() {
+    CX_UTEST_INIT_TEST("CX_ArrayRemoveValue");
+    mtrace();
+
+    for(int i=0; i<5; i++) {
+        bigBuffer();
+        CX_Status status = CX_StatusCreate();
+        CX_Array array = CX_ArrayCreateInline(sizeof(int), &valueDisposer);
+        for (int j = 1; j <= 5; j++) {
+            CX_ArrayAddValue(array, &j);
+        }
+
+        // Remove without disposing: the value is copied.
+        int removed = 0;
+        valueDisposerCalls = 0;
+        CU_ASSERT_TRUE_FATAL(CX_ArrayRemoveValue(array, 1, &removed, status));
+        CU_ASSERT_EQUAL_FATAL(removed, 2);
+        CU_ASSERT_EQUAL_FATAL(valueDisposerCalls, 0);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 4);
+
+        // Remove and dispose.
+        CU_ASSERT_TRUE_FATAL(CX_ArrayRemoveValue(array, 3, NULL, status));
+        CU_ASSERT_EQUAL_FATAL(valueDisposerCalls, 5);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 3);
+        CU_ASSERT_EQUAL_FATAL(*((int *) CX_ArrayGetValueAt(array, 0)), 1);
+        CU_ASSERT_EQUAL_FATAL(*((int *) CX_ArrayGetValueAt(array, 1)), 3);
+        CU_ASSERT_EQUAL_FATAL(*((int *) CX_ArrayGetValueAt(array, 2)), 4);
+
+        CU_ASSERT_FALSE_FATAL(CX_ArrayRemoveValue(array, 3, NULL, status));
+        CU_ASSERT_FALSE(CX_StatusIsSuccess(status));
+
+        // The remaining values are disposed with the array.
+        valueDisposerCalls = 0;
+        CX_ArrayDispose(array);
+        CU_ASSERT_EQUAL_FATAL(valueDisposerCalls, 8);
+        CX_StatusDispose(status);
+    }
+    muntrace();
+}
+
+void test_CX_ArrayReplaceValueAt() {
+    CX_UTEST_INIT_TEST("CX_ArrayReplaceValueAt");
+    mtrace();
+
+    for(int i=0; i<5; i++) {
+        CX_Status status = CX_StatusCreate();
+        CX_Array array = CX_ArrayCreateInline(sizeof(int), &valueDisposer);
+        for (int j = 0; j < 5; j++) {
+            CX_ArrayAddValue(array, &j);
+        }
+        valueDisposerCalls = 0;
+        for (int j = 0; j < 5; j++) {
+            int v = 10 * j;
+            CU_ASSERT_TRUE_FATAL(CX_ArrayReplaceValueAt(array, &v, j, status));
+        }
+        CU_ASSERT_EQUAL_FATAL(valueDisposerCalls, 0 + 1 + 2 + 3 + 4);
+        for (int j = 0; j < 5; j++) {
+            CU_ASSERT_EQUAL_FATAL(*((int *) CX_ArrayGetValueAt(array, j)), 10 * j);
+        }
+        CU_ASSERT_FALSE_FATAL(CX_ArrayReplaceValueAt(array, &i, 5, status));
+        CX_ArrayDispose(array);
+        CX_StatusDispose(status);
+    }
+    muntrace();
+}
+
+void test_CX_ArraySearchValues() {
+    CX_UTEST_INIT_TEST("CX_ArraySearchValues");
+    mtrace();
+
+    for(int i=0; i<5; i++) {
+        bigBuffer();
+        CX_Status status = CX_StatusCreate();
+        CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+        for (int j = -2; j < 5; j++) {
+            CX_ArrayAddValue(array, &j);
+        }
+
+        CX_Array result = CX_ArraySearchValues(array, &elementSearch1, status);
+        CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+        CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementSize(result), sizeof(int));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(result), 4);
+        for (int j = 0; j < 4; j++) {
+            CU_ASSERT_EQUAL_FATAL(*((int *) CX_ArrayGetValueAt(result, j)), j + 1);
+        }
+        CX_ArrayDispose(result);
+
+        result = CX_ArraySearchValues(array, &elementSearch2, status);
+        CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+        CU_ASSERT_PTR_NULL_FATAL(result);
+
+        // Duplicate the inline array.
+        CX_Array clone = CX_ArrayDup(array, status);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(clone);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(clone), CX_ArrayGetCount(array));
+        CU_ASSERT_EQUAL_FATAL(memcmp(CX_ArrayGetValues(clone), CX_ArrayGetValues(array), 7 * sizeof(int)), 0);
+        CX_ArrayDispose(clone);
+
+        CX_ArrayDispose(array);
+        CX_StatusDispose(status);
+    }
+    muntrace();
+}
+
+void test_CX_ArrayAddMany() {
+    CX_UTEST_INIT_TEST("CX_ArrayAddMany");
+    mtrace();
+
+    for(int i=0; i<5; i++) {
+        bigBuffer();
+        CX_Status status = CX_StatusCreate();
+        char *data = "ABCDEFGH";
+        void *pointers[8];
+        for (int j = 0; j < 8; j++) {
+            pointers[j] = data + j;
+        }
+
+        // Array of pointers.
+        CX_Array array = CX_ArrayCreate(NULL, &elementCloner);
+        CU_ASSERT_TRUE_FATAL(CX_ArrayAddMany(array, pointers, 3, status));
+        CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+        CU_ASSERT_TRUE_FATAL(CX_ArrayAddMany(array, pointers + 3, 5, status));
+        CU_ASSERT_TRUE_FATAL(CX_ArrayAddMany(array, pointers, 0, status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 8);
+        for (int j = 0; j < 8; j++) {
+            CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(array, j), data + j);
+        }
+        CX_ArrayDispose(array);
+
+        // Inline array.
+        int values[1000];
+        for (int j = 0; j < 1000; j++) {
+            values[j] = j;
+        }
+        array = CX_ArrayCreateInline(sizeof(int), NULL);
+        CU_ASSERT_TRUE_FATAL(CX_ArrayAddMany(array, values, 1000, status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 1000);
+        CU_ASSERT_EQUAL_FATAL(memcmp(CX_ArrayGetValues(array), values, sizeof(values)), 0);
+        CX_ArrayDispose(array);
+
+        CX_StatusDispose(status);
+    }
+    muntrace();
+}
+
+void test_CX_ArrayInsertRange() {
+    CX_UTEST_INIT_TEST("CX_ArrayInsertRange");
+    mtrace();
+
+    for(int i=0; i<5; i++) {
+        bigBuffer();
+        CX_Status status = CX_StatusCreate();
+        int first[] = {0, 1, 2, 3};
+        int middle[] = {10, 11, 12};
+
+        CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+        CU_ASSERT_TRUE_FATAL(CX_ArrayAddMany(array, first, 4, status));
+
+        // Insert in the middle.
+        CU_ASSERT_TRUE_FATAL(CX_ArrayInsertRange(array, middle, 3, 2, status));
+        CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+        // Insert at the beginning.
+        CU_ASSERT_TRUE_FATAL(CX_ArrayInsertRange(array, middle, 1, 0, status));
+        // Insert at the end.
+        CU_ASSERT_TRUE_FATAL(CX_ArrayInsertRange(array, middle + 2, 1, CX_ArrayGetCount(array), status));
+
+        int expected[] = {10, 0, 1, 10, 11, 12, 2, 3, 12};
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 9);
+        CU_ASSERT_EQUAL_FATAL(memcmp(CX_ArrayGetValues(array), expected, sizeof(expected)), 0);
+
+        // Invalid index.
+        CU_ASSERT_FALSE_FATAL(CX_ArrayInsertRange(array, middle, 3, 10, status));
+        CU_ASSERT_FALSE(CX_StatusIsSuccess(status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 9);
+
+        CX_ArrayDispose(array);
+        CX_StatusDispose(status);
+    }
+    muntrace();
+}
+
+void test_CX_ArrayRemoveRange() {
+    CX_UTEST_INIT_TEST("CX_ArrayRemoveRange");
+    mtrace();
+
+    for(int i=0; i<5; i++) {
+        bigBuffer();
+        CX_Status status = CX_StatusCreate();
+        int *element;
+
+        CX_Array array = CX_ArrayCreate(&elementDisposer, &elementCloner);
+        for (int j = 0; j < 10; j++) {
+            element = (int *) malloc(sizeof(int));
+            *element = j;
+            CX_ArrayAdd(array, element);
+        }
+
+        // Remove (and free) the elements [2, 5[.
+        CU_ASSERT_TRUE_FATAL(CX_ArrayRemoveRange(array, 2, 3, true, status));
+        CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 7);
+        int expected[] = {0, 1, 5, 6, 7, 8, 9};
+        for (int j = 0; j < 7; j++) {
+            CU_ASSERT_EQUAL_FATAL(*((int *) CX_ArrayGetElementAt(array, j)), expected[j]);
+        }
+
+        // Remove the last elements, without freeing them.
+        int *last = (int *) CX_ArrayGetElementAt(array, 6);
+        int *beforeLast = (int *) CX_ArrayGetElementAt(array, 5);
+        CU_ASSERT_TRUE_FATAL(CX_ArrayRemoveRange(array, 5, 2, false, status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 5);
+        free(last);
+        free(beforeLast);
+
+        // Invalid ranges.
+        CU_ASSERT_FALSE_FATAL(CX_ArrayRemoveRange(array, 3, 3, true, status));
+        CU_ASSERT_FALSE(CX_StatusIsSuccess(status));
+        CU_ASSERT_FALSE_FATAL(CX_ArrayRemoveRange(array, 6, 0, true, status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 5);
+
+        // Truncate the array: the removed elements are not freed.
+        last = (int *) CX_ArrayGetElementAt(array, 4);
+        CU_ASSERT_TRUE_FATAL(CX_ArrayTruncate(array, 4));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 4);
+        CU_ASSERT_EQUAL_FATAL(*last, 7);
+        free(last);
+        CU_ASSERT_TRUE_FATAL(CX_ArrayTruncate(array, 10));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 4);
+
+        // Truncate a shared array: it gets its own copy of the elements, and the other array is left untouched.
+        CX_ArraySetCopyOnWrite(array, true);
+        CX_Array snapshot = CX_ArrayDup(array, status);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(snapshot);
+        CU_ASSERT_TRUE_FATAL(CX_ArrayIsShared(array));
+        CU_ASSERT_TRUE_FATAL(CX_ArrayTruncate(array, 3));
+        CU_ASSERT_FALSE_FATAL(CX_ArrayIsShared(array));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(snapshot), 4);
+        CU_ASSERT_EQUAL_FATAL(*(int *) CX_ArrayGetElementAt(snapshot, 3), 6);
+        // The removed element is a clone: it belongs to the caller.
+        last = (int *) CX_ArrayGetElements(array)[3];
+        CU_ASSERT_NOT_EQUAL_FATAL(last, CX_ArrayGetElementAt(snapshot, 3));
+        free(last);
+        CX_ArrayDispose(snapshot);
+        CX_ArraySetCopyOnWrite(array, false);
+
+        // Remove everything.
+        CU_ASSERT_TRUE_FATAL(CX_ArrayRemoveRange(array, 0, 3, true, status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 0);
+
+
+        CX_ArrayDispose(array);
+        CX_StatusDispose(status);
+    }
+    muntrace();
+}
+
+void test_CX_ArraySearchEx() {
+    CX_UTEST_INIT_TEST("CX_ArraySearchEx");
+    mtrace();
+
+    for(int i=0; i<2; i++) {
+        bigBuffer();
+        CX_Status status = CX_StatusCreate();
+        int modulo = 3;
+        int count = 100000;
+
+        // Array of pointers.
+        CX_Array array = CX_ArrayCreate(&elementDisposer, &elementCloner);
+        CU_ASSERT_TRUE_FATAL(CX_ArrayReserve(array, count, status));
+        for (int j = 0; j < count; j++) {
+            int *element = (int *) malloc(sizeof(int));
+            *element = j;
+            CX_ArrayAdd(array, element);
+        }
+        for (unsigned int threads = 0; threads <= 4; threads++) {
+            CX_Array result = CX_ArraySearchEx(array, &elementSearchModulo, &modulo, threads, status);
+            CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+            CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+            CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(result), (count + 2) / 3);
+            for (unsigned int j = 0; j < CX_ArrayGetCount(result); j++) {
+                CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(result, j), CX_ArrayGetElementAt(array, 3 * j));
+            }
+            CX_ArrayDispose(result);
+        }
+
+        // No element found.
+        modulo = count + 1;
+        CX_Array result = CX_ArraySearchEx(array, &elementSearchModulo, &modulo, 4, status);
+        CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(result), 1);
+        CX_ArrayDispose(result);
+        CX_ArrayDispose(array);
+
+        // Inline array.
+        modulo = 7;
+        array = CX_ArrayCreateInline(sizeof(int), NULL);
+        for (int j = 1; j <= count; j++) {
+            CX_ArrayAddValue(array, &j);
+        }
+        result = CX_ArraySearchEx(array, &elementSearchModulo, &modulo, 4, status);
+        CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+        CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementSize(result), sizeof(int));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(result), count / 7);
+        for (unsigned int j = 0; j < CX_ArrayGetCount(result); j++) {
+            CU_ASSERT_EQUAL_FATAL(*((int *) CX_ArrayGetValueAt(result, j)), 7 * (j + 1));
+        }
+        CX_ArrayDispose(result);
+
+        modulo = 2 * count;
+        result = CX_ArraySearchEx(array, &elementSearchModulo, &modulo, 4, status);
+        CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+        CU_ASSERT_PTR_NULL_FATAL(result);
+        CX_ArrayDispose(array);
+
+        CX_StatusDispose(status);
+    }
+    muntrace();
+}
+
+void test_CX_ArraySort() {
+    CX_UTEST_INIT_TEST("CX_ArraySort");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int sizes[] = {0, 1, 2, 3, 15, 16, 17, 100, 1000, 20000};
+    for (int s = 0; s < sizeof(sizes) / sizeof(int); s++) {
+        int count = sizes[s];
+        int *values = (int *) malloc(sizeof(int) * (count + 1));
+        for (int kind = 0; kind < 4; kind++) {
+            fillIntegers(values, count, kind);
+
+            // Inline array.
+            CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+            CX_ArrayAddMany(array, values, count, status);
+            CX_ArraySort(array, &elementCompare, NULL);
+            int *sorted = (int *) CX_ArrayGetValues(array);
+            for (int i = 1; i < count; i++) {
+                CU_ASSERT_TRUE_FATAL(sorted[i - 1] <= sorted[i]);
+            }
+            CX_ArrayDispose(array);
+
+            // Array of pointers, sorted in descending order.
+            int direction = -1;
+            array = CX_ArrayCreate(NULL, &elementCloner);
+            for (int i = 0; i < count; i++) {
+                CX_ArrayAdd(array, values + i);
+            }
+            CX_ArraySort(array, &elementCompare, &direction);
+            CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), count);
+            for (int i = 1; i < count; i++) {
+                CU_ASSERT_TRUE_FATAL(*((int *) CX_ArrayGetElementAt(array, i - 1)) >=
+                                     *((int *) CX_ArrayGetElementAt(array, i)));
+            }
+            CX_ArrayDispose(array);
+        }
+        free(values);
+    }
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_ArraySortParallel() {
+    CX_UTEST_INIT_TEST("CX_ArraySortParallel");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int sizes[] = {10, 5000, 100001};
+    for (int s = 0; s < sizeof(sizes) / sizeof(int); s++) {
+        int count = sizes[s];
+        int *values = (int *) malloc(sizeof(int) * count);
+        for (int kind = 0; kind < 4; kind++) {
+            for (unsigned int threads = 1; threads <= 5; threads += 2) {
+                fillIntegers(values, count, kind);
+                CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+                CX_ArrayAddMany(array, values, count, status);
+                CU_ASSERT_TRUE_FATAL(CX_ArraySortParallel(array, &elementCompare, NULL, threads, status));
+                CU_ASSERT_TRUE(CX_StatusIsSuccess(status));
+                CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), count);
+                int *sorted = (int *) CX_ArrayGetValues(array);
+                long long sum = 0, expected = 0;
+                for (int i = 0; i < count; i++) {
+                    sum += sorted[i];
+                    expected += values[i];
+                    if (i > 0) {
+                        CU_ASSERT_TRUE_FATAL(sorted[i - 1] <= sorted[i]);
+                    }
+                }
+                CU_ASSERT_EQUAL_FATAL(sum, expected);
+                CX_ArrayDispose(array);
+
+                array = CX_ArrayCreate(NULL, &elementCloner);
+                for (int i = 0; i < count; i++) {
+                    CX_ArrayAdd(array, values + i);
+                }
+                CU_ASSERT_TRUE_FATAL(CX_ArraySortParallel(array, &elementCompare, NULL, threads, status));
+                for (int i = 1; i < count; i++) {
+                    CU_ASSERT_TRUE_FATAL(*((int *) CX_ArrayGetElementAt(array, i - 1)) <=
+                                         *((int *) CX_ArrayGetElementAt(array, i)));
+                }
+                CX_ArrayDispose(array);
+            }
+        }
+        free(values);
+    }
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_ArrayBinarySearch() {
+    CX_UTEST_INIT_TEST("CX_ArrayBinarySearch");
+    mtrace();
+
+    // Values: 0, 2, 4, ..., 198 with each value present twice.
+    CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+    for (int i = 0; i < 100; i++) {
+        int v = 2 * i;
+        CX_ArrayAddValue(array, &v);
+        CX_ArrayAddValue(array, &v);
+    }
+
+    size_t index;
+    for (int key = -1; key <= 200; key++) {
+        int *found = (int *) CX_ArrayBinarySearch(array, &key, &elementCompare, NULL, &index);
+        unsigned int lowerBound = CX_ArrayLowerBound(array, &key, &elementCompare, NULL);
+        CU_ASSERT_EQUAL_FATAL(index, lowerBound);
+        if (key < 0) {
+            CU_ASSERT_EQUAL_FATAL(lowerBound, 0);
+        } else {
+            CU_ASSERT_EQUAL_FATAL(lowerBound, (key + 1) / 2 * 2);
+        }
+        if (key >= 0 && key < 200 && 0 == key % 2) {
+            CU_ASSERT_PTR_NOT_NULL_FATAL(found);
+            CU_ASSERT_EQUAL_FATAL(*found, key);
+        } else {
+            CU_ASSERT_PTR_NULL_FATAL(found);
+        }
+    }
+    CX_ArrayDispose(array);
+
+    // Empty array.
+    array = CX_ArrayCreate(NULL, NULL);
+    int key = 1;
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayBinarySearch(array, &key, &elementCompare, NULL, &index));
+    CU_ASSERT_EQUAL_FATAL(index, 0);
+    CX_ArrayDispose(array);
+    muntrace();
+}
+
+void test_CX_ArrayInsertSorted() {
+    CX_UTEST_INIT_TEST("CX_ArrayInsertSorted");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int values[1000];
+    fillIntegers(values, 1000, 1);
+
+    CX_Array inlineArray = CX_ArrayCreateInline(sizeof(int), NULL);
+    CX_Array array = CX_ArrayCreate(NULL, &elementCloner);
+    for (int i = 0; i < 1000; i++) {
+        int *v = (int *) CX_ArrayInsertSorted(inlineArray, values + i, &elementCompare, NULL, status);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(v);
+        CU_ASSERT_EQUAL_FATAL(*v, values[i]);
+        v = (int *) CX_ArrayInsertSorted(array, values + i, &elementCompare, NULL, status);
+        CU_ASSERT_EQUAL_FATAL(v, values + i);
+    }
+    for (int i = 1; i < 1000; i++) {
+        CU_ASSERT_TRUE_FATAL(*((int *) CX_ArrayGetValueAt(inlineArray, i - 1)) <=
+                             *((int *) CX_ArrayGetValueAt(inlineArray, i)));
+        CU_ASSERT_TRUE_FATAL(*((int *) CX_ArrayGetElementAt(array, i - 1)) <=
+                             *((int *) CX_ArrayGetElementAt(array, i)));
+        // Equal elements keep their insertion order.
+        int *previous = (int *) CX_ArrayGetElementAt(array, i - 1);
+        int *current = (int *) CX_ArrayGetElementAt(array, i);
+        if (*previous == *current) {
+            CU_ASSERT_TRUE_FATAL(previous < current);
+        }
+    }
+    CX_ArrayDispose(inlineArray);
+    CX_ArrayDispose(array);
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_ArraySearchIndices() {
+    CX_UTEST_INIT_TEST("CX_ArraySearchIndices");
+    mtrace();
+
+    int modulo = 3;
+    size_t indices[10];
+    CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+    for (int i = 0; i < 100; i++) {
+        CX_ArrayAddValue(array, &i);
+    }
+
+    // Count only.
+    CU_ASSERT_EQUAL_FATAL(CX_ArraySearchIndices(array, &elementSearchModulo, &modulo, NULL, SIZE_MAX), 34);
+    CU_ASSERT_EQUAL_FATAL(CX_ArraySearchIndices(array, &elementSearchModulo, &modulo, NULL, 5), 5);
+
+    // Stop after the first 10 matches.
+    CU_ASSERT_EQUAL_FATAL(CX_ArraySearchIndices(array, &elementSearchModulo, &modulo, indices, 10), 10);
+    for (unsigned int i = 0; i < 10; i++) {
+        CU_ASSERT_EQUAL_FATAL(indices[i], 3 * i);
+    }
+
+    // Less matches than requested.
+    modulo = 40;
+    CU_ASSERT_EQUAL_FATAL(CX_ArraySearchIndices(array, &elementSearchModulo, &modulo, indices, 10), 3);
+    CU_ASSERT_EQUAL_FATAL(indices[0], 0);
+    CU_ASSERT_EQUAL_FATAL(indices[1], 40);
+    CU_ASSERT_EQUAL_FATAL(indices[2], 80);
+
+    CX_ArrayDispose(array);
+    muntrace();
+}
+
+void test_CX_ArraySearchBitmap() {
+    CX_UTEST_INIT_TEST("CX_ArraySearchBitmap");
+    mtrace();
+
+    int modulo = 4;
+    unsigned char bitmap[3];
+    memset(bitmap, 0xFF, sizeof(bitmap));
+    CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+    for (int i = 0; i < 20; i++) {
+        CX_ArrayAddValue(array, &i);
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_ArraySearchBitmap(array, &elementSearchModulo, &modulo, bitmap), 5);
+    CU_ASSERT_EQUAL_FATAL(bitmap[0], 0x11);
+    CU_ASSERT_EQUAL_FATAL(bitmap[1], 0x11);
+    CU_ASSERT_EQUAL_FATAL(bitmap[2], 0x01);
+    CX_ArrayDispose(array);
+    muntrace();
+}
+
+void test_CX_ArrayFilterIterator() {
+    CX_UTEST_INIT_TEST("CX_ArrayFilterIteratorNext");
+    mtrace();
+
+    int modulo = 2;
+    int values[7] = {1, 2, 3, 4, 5, 6, 7};
+    CX_Array array = CX_ArrayCreate(NULL, NULL);
+    for (int i = 0; i < 7; i++) {
+        CX_ArrayAdd(array, values + i);
+    }
+
+    CX_ArrayFilterIterator iterator;
+    void *element;
+    size_t index;
+    unsigned int found = 0;
+    CX_ArrayFilterIteratorInit(&iterator, array, &elementSearchModulo, &modulo);
+    while (CX_ArrayFilterIteratorNext(&iterator, &element, &index)) {
+        CU_ASSERT_EQUAL_FATAL(element, values + 2 * found + 1);
+        CU_ASSERT_EQUAL_FATAL(index, 2 * found + 1);
+        found++;
+    }
+    CU_ASSERT_EQUAL_FATAL(found, 3);
+    CU_ASSERT_FALSE_FATAL(CX_ArrayFilterIteratorNext(&iterator, NULL, NULL));
+
+    // Empty array.
+    CX_Array empty = CX_ArrayCreate(NULL, NULL);
+    CX_ArrayFilterIteratorInit(&iterator, empty, &elementSearchModulo, &modulo);
+    CU_ASSERT_FALSE_FATAL(CX_ArrayFilterIteratorNext(&iterator, &element, &index));
+    CX_ArrayDispose(empty);
+    CX_ArrayDispose(array);
+    muntrace();
+}
+
+void test_CX_ArrayCopyOnWrite() {
+    CX_UTEST_INIT_TEST("CX_ArraySetCopyOnWrite");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int *element;
+    CX_Array array = CX_ArrayCreate(&elementDisposer, &elementCloner);
+    CX_ArraySetCopyOnWrite(array, true);
+    for (int i = 0; i < 5; i++) {
+        element = (int *) malloc(sizeof(int));
+        CU_ASSERT_PTR_NOT_NULL_FATAL(element);
+        *element = i;
+        CX_ArrayAdd(array, (void *) element);
+    }
+
+    // The snapshots share the elements of the original array.
+    CX_Array snapshot1 = CX_ArrayDup(array, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(snapshot1);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CX_Array snapshot2 = CX_ArrayDup(snapshot1, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(snapshot2);
+    CU_ASSERT_TRUE_FATAL(CX_ArrayIsShared(array));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElements(snapshot1), CX_ArrayGetElements(array));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElements(snapshot2), CX_ArrayGetElements(array));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(snapshot2), 5);
+
+    // Modify the original array: it gets its own copy of the elements.
+    element = (int *) malloc(sizeof(int));
+    CU_ASSERT_PTR_NOT_NULL_FATAL(element);
+    *element = 5;
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, element));
+    CU_ASSERT_FALSE_FATAL(CX_ArrayIsShared(array));
+    CU_ASSERT_TRUE_FATAL(CX_ArrayIsShared(snapshot1));
+    CU_ASSERT_NOT_EQUAL_FATAL(CX_ArrayGetElementAt(array, 0), CX_ArrayGetElementAt(snapshot1, 0));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 6);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(snapshot1), 5);
+    for (int i = 0; i < 6; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(array, i), i);
+    }
+
+    // Dispose a snapshot: the last one owns the elements.
+    CX_ArrayDispose(snapshot1);
+    CU_ASSERT_FALSE_FATAL(CX_ArrayIsShared(snapshot2));
+    CU_ASSERT_TRUE_FATAL(CX_ArrayReplaceAt(snapshot2, NULL, 0, status));
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayGetElementAt(snapshot2, 0));
+    for (int i = 1; i < 5; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(snapshot2, i), i);
+    }
+    CX_ArrayRemove(snapshot2, 0, false, status);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CX_ArrayDispose(snapshot2);
+
+    // The original array is still usable.
+    CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(array, 3), 3);
+    CX_ArrayDispose(array);
+
+    // Elements that have a disposer but no cloner cannot be shared: both arrays would dispose them.
+    array = CX_ArrayCreate(&elementDisposer, NULL);
+    CX_ArraySetCopyOnWrite(array, true);
+    element = (int *) malloc(sizeof(int));
+    CU_ASSERT_PTR_NOT_NULL_FATAL(element);
+    *element = 0;
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, element));
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayDup(array, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_FALSE_FATAL(CX_ArrayIsShared(array));
+    CX_ArrayDispose(array);
+
+    // Inline array.
+    CX_Array values = CX_ArrayCreateInline(sizeof(int), NULL);
+    CX_ArraySetCopyOnWrite(values, true);
+    for (int i = 0; i < 10; i++) {
+        CX_ArrayAddValue(values, &i);
+    }
+    int descending = -1;
+    CX_Array snapshot = CX_ArrayDup(values, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(snapshot);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetValues(snapshot), CX_ArrayGetValues(values));
+    CU_ASSERT_TRUE_FATAL(CX_ArraySort(snapshot, &elementCompare, &descending));
+    CU_ASSERT_NOT_EQUAL_FATAL(CX_ArrayGetValues(snapshot), CX_ArrayGetValues(values));
+    for (int i = 0; i < 10; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetValueAt(values, i), i);
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetValueAt(snapshot, i), 9 - i);
+    }
+    // The original array is the only owner of its buffer: it is not copied again.
+    void *buffer = CX_ArrayGetValues(values);
+    CU_ASSERT_TRUE_FATAL(CX_ArrayRemoveValue(values, 0, NULL, status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetValues(values), buffer);
+    CX_ArrayDispose(snapshot);
+    CX_ArrayDispose(values);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void *failingCloner(void *inElement, CX_Status outStatus) {
+    if (*((int*)inElement) == 12345) {
+        CX_StatusSetError(outStatus, 0, "Cannot clone the element %d!", 12345);
+        return NULL;
+    }
+    return elementCloner(inElement, outStatus);
+}
+
+void test_CX_ArrayDupParallel() {
+    CX_UTEST_INIT_TEST("CX_ArrayDupParallel");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    CX_Array array = CX_ArrayCreate(&elementDisposer, &elementCloner);
+    for (int i = 0; i < 20000; i++) {
+        int *element = (int *) malloc(sizeof(int));
+        CU_ASSERT_PTR_NOT_NULL_FATAL(element);
+        *element = i;
+        CX_ArrayAdd(array, (void *) element);
+    }
+
+    unsigned int threads[] = {0, 1, 3, 8};
+    for (int t = 0; t < 4; t++) {
+        CX_Array clone = CX_ArrayDupParallel(array, threads[t], status);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(clone);
+        CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(clone), 20000);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(clone), 20000);
+        for (int i = 0; i < 20000; i++) {
+            CU_ASSERT_NOT_EQUAL_FATAL(CX_ArrayGetElementAt(clone, i), CX_ArrayGetElementAt(array, i));
+            CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(clone, i), i);
+        }
+        CX_ArrayDispose(clone);
+    }
+
+    // The cloner fails: the elements already cloned are disposed.
+    array->elementCloner = &failingCloner;
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayDupParallel(array, 4, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_STRING_EQUAL_FATAL(CX_StatusGetMessage(status), "Cannot clone the element 12345!");
+
+    CX_ArrayDispose(array);
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_ArrayDeque() {
+    CX_UTEST_INIT_TEST("CX_ArrayCreateDeque");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int values[1000];
+    for (int i = 0; i < 1000; i++) {
+        values[i] = i;
+    }
+
+    // Push at both ends: [499, ..., 0, 500, ..., 999]
+    CX_Array deque = CX_ArrayCreateDeque(NULL, &elementCloner);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(deque);
+    for (int i = 0; i < 500; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayPushFront(deque, values + i), values + i);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayAdd(deque, values + 500 + i), values + 500 + i);
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(deque), 1000);
+    for (int i = 0; i < 500; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, i), values + 499 - i);
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 500 + i), values + 500 + i);
+    }
+
+    // Insert and remove close to both ends.
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayInsertAt(deque, values, 1, status));
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayInsertAt(deque, values + 1, 999, status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 0), values + 499);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 1), values);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 2), values + 498);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 999), values + 1);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 1000), values + 998);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayRemove(deque, 1, false, status), values);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayRemove(deque, 998, false, status), values + 1);
+    CU_ASSERT_TRUE_FATAL(CX_ArrayRemoveRange(deque, 0, 400, false, status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(deque), 600);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 0), values + 99);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 599), values + 999);
+
+    // The clone is a deque too. Its elements are clones: they must be freed.
+    CX_Array clone = CX_ArrayDup(deque, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(clone);
+    clone->elementDisposer = &elementDisposer;
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayPushFront(clone, values));
+    CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(clone, 1), 99);
+    CX_ArrayRemove(clone, 0, false, status);
+    CX_ArrayDispose(clone);
+
+    // Release the free slots.
+    CU_ASSERT_TRUE_FATAL(CX_ArrayShrinkToFit(deque, status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(deque), 600);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 0), values + 99);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 599), values + 999);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayPushFront(deque, values));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 0), values);
+    CX_ArrayDispose(deque);
+
+    // Use the deque as a queue: the memory does not grow.
+    deque = CX_ArrayCreateDeque(NULL, NULL);
+    for (int i = 0; i < 100; i++) {
+        CX_ArrayAdd(deque, values + i);
+    }
+    for (int i = 100; i < 100000; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayRemove(deque, 0, false, status), values + (i - 100) % 1000);
+        CX_ArrayAdd(deque, values + i % 1000);
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(deque), 100);
+    CU_ASSERT_TRUE_FATAL(deque->front + CX_ArrayGetCapacity(deque) <= 1000);
+    CX_ArrayDispose(deque);
+
+    // A regular array also supports insertions at the beginning.
+    CX_Array array = CX_ArrayCreate(NULL, NULL);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayPushFront(array, values));
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayPushFront(array, values + 1));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(array, 0), values + 1);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(array, 1), values);
+    CX_ArrayDispose(array);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_ArrayArena() {
+    CX_UTEST_INIT_TEST("CX_ArrayAllocElement");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    CX_Array array = CX_ArrayCreateArena();
+    CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+    for (int i = 0; i < 100000; i++) {
+        int *element = (int*)CX_ArrayAllocElement(array, sizeof(int));
+        CU_ASSERT_PTR_NOT_NULL_FATAL(element);
+        CU_ASSERT_EQUAL_FATAL((size_t)element % 16, 0);
+        *element = i;
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, element));
+    }
+    for (int i = 0; i < 100000; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(array, i), i);
+    }
+
+    // Elements larger than a chunk.
+    char *big = (char*)CX_ArrayAllocElement(array, 3 * 1024 * 1024);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(big);
+    memset(big, 'A', 3 * 1024 * 1024);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAllocElement(array, 0));
+
+    // The removed elements are released with the arena.
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayRemove(array, 0, true, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CU_ASSERT_TRUE_FATAL(CX_ArrayRemoveRange(array, 0, 10, true, status));
+    CU_ASSERT_TRUE_FATAL(CX_ArrayReplaceAt(array, big, 0, status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 99989);
+    CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(array, 1), 12);
+
+    // An arena array cannot be cloned, and its elements cannot be given away.
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayDup(array, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_FALSE_FATAL(CX_ArrayTruncate(array, 10));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 99989);
+    CX_ArrayDispose(array);
+
+    // Only arena arrays allocate elements.
+    array = CX_ArrayCreate(NULL, NULL);
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayAllocElement(array, sizeof(int)));
+    CX_ArrayDispose(array);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_ArrayHugePages() {
+    CX_UTEST_INIT_TEST("CX_ArraySetHugePageThreshold");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    CX_Array array = CX_ArrayCreate(NULL, NULL);
+    CX_ArraySetHugePageThreshold(array, 2 * 1024 * 1024);
+    for (size_t i = 0; i < 1000000; i++) {
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, values + i % 10));
+    }
+    // 1000000 pointers: the buffer is mapped.
+    CU_ASSERT_TRUE_FATAL(array->mapped >= CX_ArrayGetCapacity(array) * sizeof(void*));
+    CU_ASSERT_EQUAL_FATAL(array->mapped % (2 * 1024 * 1024), 0);
+    for (size_t i = 0; i < 1000000; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(array, i), values + i % 10);
+    }
+
+    // Small buffers are not mapped.
+    CU_ASSERT_TRUE_FATAL(CX_ArrayRemoveRange(array, 10, 1000000 - 10, false, status));
+    CU_ASSERT_TRUE_FATAL(CX_ArrayShrinkToFit(array, status));
+    CU_ASSERT_EQUAL_FATAL(array->mapped, 0);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(array), 10);
+    for (size_t i = 0; i < 10; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(array, i), values + i);
+    }
+    CU_ASSERT_TRUE_FATAL(CX_ArrayReserve(array, 1000000, status));
+    CU_ASSERT_NOT_EQUAL_FATAL(array->mapped, 0);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(array, 9), values + 9);
+    CX_ArrayDispose(array);
+
+    // The clones are mapped too.
+    CX_Array inlineArray = CX_ArrayCreateInline(sizeof(int), NULL);
+    CX_ArraySetHugePageThreshold(inlineArray, 2 * 1024 * 1024);
+    for (int i = 0; i < 1000000; i++) {
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAddValue(inlineArray, &i));
+    }
+    CX_Array clone = CX_ArrayDup(inlineArray, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(clone);
+    CU_ASSERT_NOT_EQUAL_FATAL(clone->mapped, 0);
+    for (int i = 0; i < 1000000; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetValueAt(clone, i), i);
+    }
+    CX_ArrayDispose(clone);
+    CX_ArrayDispose(inlineArray);
+
+    // Deque.
+    CX_Array deque = CX_ArrayCreateDeque(NULL, NULL);
+    CX_ArraySetHugePageThreshold(deque, 2 * 1024 * 1024);
+    for (size_t i = 0; i < 500000; i++) {
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayPushFront(deque, values + i % 10));
+    }
+    CU_ASSERT_NOT_EQUAL_FATAL(deque->mapped, 0);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(deque, 0), values + 499999 % 10);
+    CX_ArrayDispose(deque);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_ArraySmall() {
+    CX_UTEST_INIT_TEST("CX_ArraySmall");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    // The first elements are stored within the container.
+    CX_Array array = CX_ArrayCreate(NULL, NULL);
+    for (int i = 0; i < CX_ARRAY_SMALL_CAPACITY; i++) {
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, values + i));
+        CU_ASSERT_EQUAL_FATAL(array->elements, array->small);
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCapacity(array), CX_ARRAY_SMALL_CAPACITY);
+
+    // Then, they spill to the heap.
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayInsertAt(array, values + 9, 0, status));
+    CU_ASSERT_NOT_EQUAL_FATAL(array->elements, array->small);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(array, 0), values + 9);
+    for (size_t i = 1; i <= CX_ARRAY_SMALL_CAPACITY; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(array, i), values + i - 1);
+    }
+
+    // And they come back when the buffer is shrunk.
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayRemove(array, 0, false, status));
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayRemove(array, 0, false, status));
+    CU_ASSERT_TRUE_FATAL(CX_ArrayShrinkToFit(array, status));
+    CU_ASSERT_EQUAL_FATAL(array->elements, array->small);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), CX_ARRAY_SMALL_CAPACITY - 1);
+    for (size_t i = 0; i < CX_ARRAY_SMALL_CAPACITY - 1; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(array, i), values + i + 1);
+    }
+
+    // A copy-on-write clone gets its own small buffer.
+    CX_ArraySetCopyOnWrite(array, true);
+    CX_Array clone = CX_ArrayDup(array, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(clone);
+    CU_ASSERT_EQUAL_FATAL(clone->elements, clone->small);
+    CX_ArrayDispose(array);
+    for (size_t i = 0; i < CX_ARRAY_SMALL_CAPACITY - 1; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementAt(clone, i), values + i + 1);
+    }
+    CX_ArrayDispose(clone);
+
+    // Small values are stored within the container too.
+    CX_Array inlineArray = CX_ArrayCreateInline(sizeof(char), NULL);
+    for (char c = 'a'; c <= 'z'; c++) {
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAddValue(inlineArray, &c));
+    }
+    CU_ASSERT_EQUAL_FATAL(inlineArray->elements, inlineArray->small);
+    CU_ASSERT_EQUAL_FATAL(*(char*)CX_ArrayGetValueAt(inlineArray, 25), 'z');
+    CX_ArrayDispose(inlineArray);
+
+    // But not large values, nor the elements of a deque.
+    inlineArray = CX_ArrayCreateInline(2 * sizeof(void*), NULL);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAddValue(inlineArray, values));
+    CU_ASSERT_NOT_EQUAL_FATAL(inlineArray->elements, inlineArray->small);
+    CX_ArrayDispose(inlineArray);
+    CX_Array deque = CX_ArrayCreateDeque(NULL, NULL);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayPushFront(deque, values));
+    CU_ASSERT_NOT_EQUAL_FATAL(deque->elements, deque->small);
+    CX_ArrayDispose(deque);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_ArraySwapRemove() {
+    CX_UTEST_INIT_TEST("CX_ArraySwapRemove");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    CX_Array array = CX_ArrayCreate(&elementDisposer, &elementCloner);
+    for (int i = 0; i < 10; i++) {
+        int *element = (int*)malloc(sizeof(int));
+        *element = i;
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, element));
+    }
+
+    // The last element takes the place of the removed one.
+    int *removed = (int*)CX_ArraySwapRemove(array, 2, false, status);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CU_ASSERT_EQUAL_FATAL(*removed, 2);
+    free(removed);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 9);
+    CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(array, 2), 9);
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArraySwapRemove(array, 8, true, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 8);
+    CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(array, 7), 7);
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArraySwapRemove(array, 8, true, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CX_ArrayDispose(array);
+
+    // Inline Array object.
+    array = CX_ArrayCreateInline(sizeof(int), NULL);
+    for (int i = 0; i < 10; i++) {
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAddValue(array, &i));
+    }
+    int value;
+    CU_ASSERT_TRUE_FATAL(CX_ArraySwapRemoveValue(array, 0, &value, status));
+    CU_ASSERT_EQUAL_FATAL(value, 0);
+    CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetValueAt(array, 0), 9);
+    CU_ASSERT_TRUE_FATAL(CX_ArraySwapRemoveValue(array, 8, NULL, status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 8);
+    CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetValueAt(array, 7), 7);
+    CU_ASSERT_FALSE_FATAL(CX_ArraySwapRemoveValue(array, 8, NULL, status));
+    CX_ArrayDispose(array);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_ArrayRemoveIf() {
+    CX_UTEST_INIT_TEST("CX_ArrayRemoveIf");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int modulo = 3;
+    CX_Array array = CX_ArrayCreate(&elementDisposer, &elementCloner);
+    for (int i = 0; i < 100000; i++) {
+        int *element = (int*)malloc(sizeof(int));
+        *element = i;
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, element));
+    }
+
+    // The kept elements keep their order, and the removed elements are disposed.
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayRemoveIf(array, &elementSearchModulo, &modulo, true, status), 33334);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 66666);
+    for (size_t i = 0; i < 66666; i++) {
+        int value = *(int*)CX_ArrayGetElementAt(array, i);
+        CU_ASSERT_EQUAL_FATAL(value, (int)(i / 2 * 3 + 1 + i % 2));
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayRemoveIf(array, &elementSearchModulo, &modulo, true, status), 0);
+    CX_ArrayDispose(array);
+
+    // The elements cannot be freed without disposer.
+    array = CX_ArrayCreateInline(sizeof(int), NULL);
+    for (int i = 0; i < 100; i++) {
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAddValue(array, &i));
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayRemoveIf(array, &elementSearchModulo, &modulo, true, status), 0);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 100);
+
+    // Inline Array object.
+    modulo = 2;
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayRemoveIf(array, &elementSearchModulo, &modulo, false, status), 50);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    for (size_t i = 0; i < 50; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetValueAt(array, i), (int)(2 * i + 1));
+    }
+    CX_ArrayDispose(array);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+const void *intRecord(void *inElement, size_t *outLength) {
+    // Odd elements are saved as empty records.
+    *outLength = *(int*)inElement % 2 ? 0 : sizeof(int);
+    return inElement;
+}
+
+void test_CX_ArrayImage() {
+    CX_UTEST_INIT_TEST("CX_ArrayImage");
+    mtrace();
+
+    const char *path = "/tmp/test_CX_ArrayImage.bin";
+    CX_Status status = CX_StatusCreate();
+
+    // Inline image.
+    CX_Array array = CX_ArrayCreateInline(sizeof(long), NULL);
+    for (long i = 0; i < 10000; i++) {
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAddValue(array, &i));
+    }
+    CU_ASSERT_TRUE_FATAL(CX_ArraySaveInline(array, path, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CX_ArrayDispose(array);
+
+    array = CX_ArrayLoadInlineMapped(path, status);
+    CU_ASSERT_NOT_EQUAL_FATAL(array, NULL);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 10000);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetElementSize(array), sizeof(long));
+    for (long i = 0; i < 10000; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(long*)CX_ArrayGetValueAt(array, i), i);
+    }
+    CX_Array clone = CX_ArrayDup(array, status);
+    CU_ASSERT_NOT_EQUAL_FATAL(clone, NULL);
+    CU_ASSERT_EQUAL_FATAL(*(long*)CX_ArrayGetValueAt(clone, 9999), 9999);
+    CX_ArrayDispose(clone);
+
+    // The loaded Array object can be modified, and it can grow.
+    long value = -1;
+    CU_ASSERT_TRUE_FATAL(CX_ArrayReplaceValueAt(array, &value, 0, status));
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAddValue(array, &value));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 10001);
+    CU_ASSERT_EQUAL_FATAL(*(long*)CX_ArrayGetValueAt(array, 0), -1);
+    CU_ASSERT_EQUAL_FATAL(*(long*)CX_ArrayGetValueAt(array, 5000), 5000);
+    CU_ASSERT_EQUAL_FATAL(*(long*)CX_ArrayGetValueAt(array, 10000), -1);
+    CX_ArrayDispose(array);
+
+    // The file is left untouched.
+    array = CX_ArrayLoadInlineMapped(path, status);
+    CU_ASSERT_NOT_EQUAL_FATAL(array, NULL);
+    CU_ASSERT_EQUAL_FATAL(*(long*)CX_ArrayGetValueAt(array, 0), 0);
+    CX_ArrayDispose(array);
+
+    // An inline image is not a records image.
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayLoadRecordsMapped(path, NULL, NULL, status), NULL);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+
+    // Records image.
+    array = CX_ArrayCreate(&elementDisposer, &elementCloner);
+    for (int i = 0; i < 1000; i++) {
+        int *element = (int*)malloc(sizeof(int));
+        *element = i;
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, element));
+    }
+    CU_ASSERT_TRUE_FATAL(CX_ArraySaveRecords(array, path, &intRecord, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CX_ArrayDispose(array);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayLoadInlineMapped(path, status), NULL);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+
+    array = CX_ArrayLoadRecordsMapped(path, NULL, NULL, status);
+    CU_ASSERT_NOT_EQUAL_FATAL(array, NULL);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 1000);
+    for (int i = 0; i < 1000; i++) {
+        char *data = *(char**)CX_ArrayGetElementAt(array, i);
+        if (i % 2) {
+            CU_ASSERT_EQUAL_FATAL(data[0], 0);
+        } else {
+            CU_ASSERT_EQUAL_FATAL(*(int*)data, i);
+            CU_ASSERT_EQUAL_FATAL(data[sizeof(int)], 0);
+        }
+    }
+    CX_ArrayDispose(array);
+
+    // A record which data is not terminated by a zero.
+    array = CX_ArrayCreate(&elementDisposer, &elementCloner);
+    int marker = 0x41424344;
+    int *element = (int*)malloc(sizeof(int));
+    *element = marker;
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, element));
+    element = (int*)malloc(sizeof(int));
+    *element = 1;
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAdd(array, element));
+    CU_ASSERT_TRUE_FATAL(CX_ArraySaveRecords(array, path, &intRecord, status));
+    CX_ArrayDispose(array);
+    char content[256];
+    FILE *file = fopen(path, "rb");
+    CU_ASSERT_NOT_EQUAL_FATAL(file, NULL);
+    size_t size = fread(content, 1, sizeof(content), file);
+    fclose(file);
+    size_t position = 0;
+    while (position + sizeof(int) < size && 0 != memcmp(content + position, &marker, sizeof(int))) {
+        position++;
+    }
+    CU_ASSERT_TRUE_FATAL(position + sizeof(int) < size);
+    content[position + sizeof(int)] = 'x';
+    file = fopen(path, "wb");
+    CU_ASSERT_EQUAL_FATAL(fwrite(content, 1, size, file), size);
+    fclose(file);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayLoadRecordsMapped(path, NULL, NULL, status), NULL);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+
+    // Invalid images.
+    file = fopen(path, "wb");
+    CU_ASSERT_NOT_EQUAL_FATAL(file, NULL);
+    fputs("This is not an image, but it is longer than a header.", file);
+    fclose(file);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayLoadRecordsMapped(path, NULL, NULL, status), NULL);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    remove(path);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayLoadInlineMapped(path, status), NULL);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void doubleValue(void *inElement, size_t inIndex, void *inContext) {
+    // The value of an element is its position.
+    *(int*)inElement = *(int*)inElement + (int)inIndex + *(int*)inContext;
+}
+
+void *mapClone(void *inElement, void *inContext, CX_Status outStatus) {
+    if (-1 == *(int*)inElement) {
+        CX_StatusSetError(outStatus, 0, "Cannot map %d!", *(int*)inElement);
+        return NULL;
+    }
+    return elementCloner(inElement, outStatus);
+}
+
+struct Summary {
+    long long sum;
+    int last;
+};
+
+void accumulateSummary(void *ioSummary, void *inElement, void *inContext) {
+    struct Summary *summary = (struct Summary*)ioSummary;
+    summary->sum += *(int*)inElement;
+    summary->last = *(int*)inElement;
+}
+
+void combineSummary(void *ioSummary, void *inPartial, void *inContext) {
+    struct Summary *summary = (struct Summary*)ioSummary;
+    struct Summary *partial = (struct Summary*)inPartial;
+    summary->sum += partial->sum;
+    if (-1 != partial->last) {
+        summary->last = partial->last;
+    }
+}
+
+void test_CX_ArrayBulkParallel() {
+    CX_UTEST_INIT_TEST("CX_ArrayForEachParallel");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    CX_Array array = CX_ArrayCreateInline(sizeof(int), NULL);
+    for (int i = 0; i < 100000; i++) {
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_ArrayAddValue(array, &i));
+    }
+
+    // For each: the values are modified in place.
+    int offset = 1;
+    CU_ASSERT_TRUE_FATAL(CX_ArrayForEachParallel(array, &doubleValue, &offset, 1000, 4, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    for (int i = 0; i < 100000; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetValueAt(array, i), 2 * i + 1);
+    }
+
+    // Reduce: the partial results are combined in order.
+    struct Summary summary = {0, -1};
+    CU_ASSERT_TRUE_FATAL(CX_ArrayReduceParallel(array, &summary, sizeof(summary), &accumulateSummary,
+                                                &combineSummary, NULL, 1000, 8, status));
+    CU_ASSERT_EQUAL_FATAL(summary.sum, 100000LL * 100000LL);
+    CU_ASSERT_EQUAL_FATAL(summary.last, 2 * 99999 + 1);
+    struct Summary serial = {0, -1};
+    CU_ASSERT_TRUE_FATAL(CX_ArrayReduceParallel(array, &serial, sizeof(serial), &accumulateSummary,
+                                                &combineSummary, NULL, 0, 1, status));
+    CU_ASSERT_EQUAL_FATAL(serial.sum, summary.sum);
+    CU_ASSERT_EQUAL_FATAL(serial.last, summary.last);
+
+    // Map: the results keep the order of the elements.
+    CX_Array mapped = CX_ArrayMapParallel(array, &mapClone, NULL, &elementDisposer, &elementCloner, 100, 0, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(mapped);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(mapped), 100000);
+    for (size_t i = 0; i < 100000; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(mapped, i), *(int*)CX_ArrayGetValueAt(array, i));
+    }
+    CX_ArrayDispose(mapped);
+
+    // Map: the first error is reported, and the results are disposed.
+    int failure = -1;
+    CU_ASSERT_TRUE_FATAL(CX_ArrayReplaceValueAt(array, &failure, 50000, status));
+    mapped = CX_ArrayMapParallel(array, &mapClone, NULL, &elementDisposer, &elementCloner, 100, 0, status);
+    CU_ASSERT_PTR_NULL_FATAL(mapped);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_STRING_EQUAL_FATAL(CX_StatusGetMessage(status), "Cannot map -1!");
+
+    // Empty arrays.
+    CX_ArrayDispose(array);
+    array = CX_ArrayCreateInline(sizeof(int), NULL);
+    mapped = CX_ArrayMapParallel(array, &mapClone, NULL, &elementDisposer, &elementCloner, 0, 0, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(mapped);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(mapped), 0);
+    CX_ArrayDispose(mapped);
+    CU_ASSERT_TRUE_FATAL(CX_ArrayForEachParallel(array, &doubleValue, &offset, 0, 0, status));
+    CX_ArrayDispose(array);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+#define CONCURRENT_PRODUCERS 8
+#define CONCURRENT_ADDS 100000
+
+struct ConcurrentProducer {
+    CX_Array array;
+    uintptr_t id;
+    size_t failures;
+};
+
+/**
+ * Add encoded values (producer identifier, sequence number) to a concurrent array.
+ */
+
+void *concurrentProducer(void *inContext) {
+    struct ConcurrentProducer *producer = (struct ConcurrentProducer*)inContext;
+    for (uintptr_t i = 0; i < CONCURRENT_ADDS; i++) {
+        void *element = (void*)(producer->id * CONCURRENT_ADDS + i + 1);
+        if (element != CX_ArrayConcurrentAdd(producer->array, element)) {
+            producer->failures++;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Check that the values added by each producer appear in order, without gaps.
+ */
+
+bool checkConcurrentOrder(void **inElements, size_t inCount, bool inComplete) {
+    uintptr_t next[CONCURRENT_PRODUCERS] = {0};
+    for (size_t i = 0; i < inCount; i++) {
+        uintptr_t value = (uintptr_t)inElements[i];
+        if (0 == value) {
+            return false;
+        }
+        value -= 1;
+        if (value % CONCURRENT_ADDS != next[value / CONCURRENT_ADDS]++) {
+            return false;
+        }
+    }
+    for (int i = 0; inComplete && i < CONCURRENT_PRODUCERS; i++) {
+        if (CONCURRENT_ADDS != next[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_CX_ArrayConcurrent() {
+    CX_UTEST_INIT_TEST("CX_ArrayConcurrentAdd");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    CX_Array array = CX_ArrayCreateConcurrent(NULL, NULL);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayConcurrentGetCount(array), 0);
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayConcurrentGetAt(array, 0));
+
+    pthread_t threads[CONCURRENT_PRODUCERS];
+    struct ConcurrentProducer producers[CONCURRENT_PRODUCERS];
+    for (int i = 0; i < CONCURRENT_PRODUCERS; i++) {
+        producers[i].array = array;
+        producers[i].id = (uintptr_t)i;
+        producers[i].failures = 0;
+        CU_ASSERT_EQUAL_FATAL(pthread_create(threads + i, NULL, &concurrentProducer, producers + i), 0);
+    }
+
+    // Take snapshots while the producers add elements: each one must be a consistent prefix.
+    size_t previous = 0;
+    for (int i = 0; i < 20; i++) {
+        CX_Array snapshot = CX_ArrayConcurrentSnapshot(array, status);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(snapshot);
+        CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+        size_t count = CX_ArrayGetCount(snapshot);
+        CU_ASSERT_TRUE_FATAL(count >= previous);
+        CU_ASSERT_TRUE_FATAL(checkConcurrentOrder(snapshot->elements, count, false));
+        if (count > 0) {
+            CU_ASSERT_EQUAL_FATAL(CX_ArrayConcurrentGetAt(array, count - 1), snapshot->elements[count - 1]);
+        }
+        previous = count;
+        CX_ArrayDispose(snapshot);
+    }
+
+    for (int i = 0; i < CONCURRENT_PRODUCERS; i++) {
+        CU_ASSERT_EQUAL_FATAL(pthread_join(threads[i], NULL), 0);
+        CU_ASSERT_EQUAL_FATAL(producers[i].failures, 0);
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayConcurrentGetCount(array), CONCURRENT_PRODUCERS * CONCURRENT_ADDS);
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayConcurrentGetAt(array, CONCURRENT_PRODUCERS * CONCURRENT_ADDS));
+
+    // Seal the array: it becomes a regular array.
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), 0);
+    CU_ASSERT_TRUE_FATAL(CX_ArrayConcurrentSeal(array, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CU_ASSERT_PTR_NULL_FATAL(array->concurrent);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), CONCURRENT_PRODUCERS * CONCURRENT_ADDS);
+    CU_ASSERT_TRUE_FATAL(checkConcurrentOrder(array->elements, CX_ArrayGetCount(array), true));
+
+    // The concurrent functions reject a sealed array.
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayConcurrentAdd(array, (void*)1));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayConcurrentGetCount(array), 0);
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayConcurrentGetAt(array, 0));
+    CX_Array snapshot = CX_ArrayConcurrentSnapshot(array, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(snapshot);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(snapshot), 0);
+    CX_ArrayDispose(snapshot);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(array), CONCURRENT_PRODUCERS * CONCURRENT_ADDS);
+    CX_ArrayDispose(array);
+
+    // The published elements are disposed with the array.
+    array = CX_ArrayCreateConcurrent(&elementDisposer, &elementCloner);
+    for (int i = 0; i < 1000; i++) {
+        int *element = (int*)malloc(sizeof(int));
+        *element = i;
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayConcurrentAdd(array, element), element);
+    }
+    for (size_t i = 0; i < 1000; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayConcurrentGetAt(array, i), (int)i);
+    }
+
+    // An unsealed concurrent array cannot be cloned, even in copy-on-write mode.
+    CX_ArraySetCopyOnWrite(array, true);
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayDup(array, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_TRUE_FATAL(CX_ArrayConcurrentSeal(array, status));
+    CX_Array clone = CX_ArrayDup(array, status);
+    CU_ASSERT_NOT_EQUAL_FATAL(clone, NULL);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayGetCount(clone), 1000);
+    CX_ArrayDispose(array);
+    CU_ASSERT_EQUAL_FATAL(*(int*)CX_ArrayGetElementAt(clone, 999), 999);
+    CX_ArrayDispose(clone);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
 
 int main (int argc, char *argv[])
 {
@@ -514,7 +2218,39 @@ int main (int argc, char *argv[])
         &test_CX_ArrayRemove,
         &test_CX_ArraySearch,
         &test_CX_ArrayDup,
-        &test_CX_ArrayReplaceAt
+        &test_CX_ArrayReplaceAt,
+        &test_CX_ArrayReserve,
+        &test_CX_ArrayShrinkToFit,
+        &test_CX_ArrayCreateInline,
+        &test_CX_ArrayInlinePointerFunctions,
+        &test_CX_ArrayPointerValueFunctions,
+        &test_CX_ArrayAddValue,
+        &test_CX_ArrayInsertValueAt,
+        &test_CX_ArrayRemoveValue,
+        &test_CX_ArrayReplaceValueAt,
+        &test_CX_ArraySearchValues,
+        &test_CX_ArrayAddMany,
+        &test_CX_ArrayInsertRange,
+        &test_CX_ArrayRemoveRange,
+        &test_CX_ArraySearchEx,
+        &test_CX_ArraySort,
+        &test_CX_ArraySortParallel,
+        &test_CX_ArrayBinarySearch,
+        &test_CX_ArrayInsertSorted,
+        &test_CX_ArraySearchIndices,
+        &test_CX_ArraySearchBitmap,
+        &test_CX_ArrayFilterIterator,
+        &test_CX_ArrayCopyOnWrite,
+        &test_CX_ArrayDupParallel,
+        &test_CX_ArrayDeque,
+        &test_CX_ArrayArena,
+        &test_CX_ArrayHugePages,
+        &test_CX_ArrayConcurrent,
+        &test_CX_ArrayBulkParallel,
+        &test_CX_ArraySmall,
+        &test_CX_ArraySwapRemove,
+        &test_CX_ArrayRemoveIf,
+        &test_CX_ArrayImage
     };
 
     CU_pSuite pSuite1 = NULL;
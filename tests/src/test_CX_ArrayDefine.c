@@ -0,0 +1,216 @@
+#include <mcheck.h>
+#include <stdlib.h>
+#include "CX_UTest.h"
+#include "CUnit/CUnit.h"
+#include "CUnit/Basic.h"
+#include "CX_ArrayDefine.h"
+
+typedef struct {
+    double x;
+    double y;
+} Point;
+
+CX_ARRAY_DEFINE(IntArray, int)
+CX_ARRAY_DEFINE(PointArray, Point)
+
+// Define mandatory callbacks.
+int init_suite(void) {
+    CX_UTEST_INIT_ALL("src/CX_ArrayDefine.h");
+    return 0;
+}
+
+int clean_suite(void) {
+    return 0;
+}
+
+int compareInt(const int *inA, const int *inB) {
+    return *inA < *inB ? -1 : (*inA > *inB ? 1 : 0);
+}
+
+int comparePoint(const Point *inA, const Point *inB) {
+    return inA->x < inB->x ? -1 : (inA->x > inB->x ? 1 : 0);
+}
+
+int compareIntQsort(const void *inA, const void *inB) {
+    return compareInt((const int*)inA, (const int*)inB);
+}
+
+void test_CX_ArrayDefineAdd() {
+    CX_UTEST_INIT_TEST("CX_ARRAY_DEFINE");
+    mtrace();
+
+    IntArray array = IntArrayCreate();
+    CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+    CU_ASSERT_EQUAL_FATAL(IntArrayGetCount(array), 0);
+    CU_ASSERT_PTR_NULL_FATAL(IntArrayGetAt(array, 0));
+    for (int i = 0; i < 1000; i++) {
+        CU_ASSERT_TRUE_FATAL(IntArrayAdd(array, i));
+    }
+    CU_ASSERT_EQUAL_FATAL(IntArrayGetCount(array), 1000);
+    CU_ASSERT_TRUE_FATAL(IntArrayGetCapacity(array) >= 1000);
+    for (int i = 0; i < 1000; i++) {
+        CU_ASSERT_EQUAL_FATAL(IntArrayAt(array, i), i);
+        CU_ASSERT_EQUAL_FATAL(*IntArrayGetAt(array, i), i);
+        CU_ASSERT_EQUAL_FATAL(IntArrayGetValues(array)[i], i);
+    }
+    CU_ASSERT_PTR_NULL_FATAL(IntArrayGetAt(array, 1000));
+
+    IntArraySet(array, 10, -10);
+    CU_ASSERT_EQUAL_FATAL(IntArrayAt(array, 10), -10);
+
+    CU_ASSERT_TRUE_FATAL(IntArrayReserve(array, 5000));
+    CU_ASSERT_EQUAL_FATAL(IntArrayGetCapacity(array), 5000);
+    IntArrayClear(array);
+    CU_ASSERT_EQUAL_FATAL(IntArrayGetCount(array), 0);
+    IntArrayDispose(array);
+
+    // Structures.
+    PointArray points = PointArrayCreate();
+    CU_ASSERT_PTR_NOT_NULL_FATAL(points);
+    for (int i = 0; i < 100; i++) {
+        Point point = {(double)i, (double)-i};
+        CU_ASSERT_TRUE_FATAL(PointArrayAdd(points, point));
+    }
+    CU_ASSERT_EQUAL_FATAL(PointArrayAt(points, 42).x, 42.0);
+    CU_ASSERT_EQUAL_FATAL(PointArrayGetAt(points, 42)->y, -42.0);
+    PointArrayDispose(points);
+    muntrace();
+}
+
+void test_CX_ArrayDefineInsertRemove() {
+    CX_UTEST_INIT_TEST("CX_ARRAY_DEFINE");
+    mtrace();
+
+    int value;
+    IntArray array = IntArrayCreate();
+    CU_ASSERT_TRUE_FATAL(IntArrayInsertAt(array, 1, 0));
+    CU_ASSERT_TRUE_FATAL(IntArrayInsertAt(array, 3, 1));
+    CU_ASSERT_TRUE_FATAL(IntArrayInsertAt(array, 2, 1));
+    CU_ASSERT_TRUE_FATAL(IntArrayInsertAt(array, 0, 0));
+    CU_ASSERT_FALSE_FATAL(IntArrayInsertAt(array, 5, 5));
+    CU_ASSERT_EQUAL_FATAL(IntArrayGetCount(array), 4);
+    for (int i = 0; i < 4; i++) {
+        CU_ASSERT_EQUAL_FATAL(IntArrayAt(array, i), i);
+    }
+
+    CU_ASSERT_TRUE_FATAL(IntArrayRemove(array, 1, &value));
+    CU_ASSERT_EQUAL_FATAL(value, 1);
+    CU_ASSERT_TRUE_FATAL(IntArrayRemove(array, 2, NULL));
+    CU_ASSERT_FALSE_FATAL(IntArrayRemove(array, 2, &value));
+    CU_ASSERT_EQUAL_FATAL(IntArrayGetCount(array), 2);
+    CU_ASSERT_EQUAL_FATAL(IntArrayAt(array, 0), 0);
+    CU_ASSERT_EQUAL_FATAL(IntArrayAt(array, 1), 2);
+    IntArrayDispose(array);
+    muntrace();
+}
+
+void test_CX_ArrayDefineSort() {
+    CX_UTEST_INIT_TEST("CX_ARRAY_DEFINE");
+    mtrace();
+
+    unsigned int sizes[] = {0, 1, 2, 15, 16, 17, 100, 1000, 50000};
+    for (int kind = 0; kind < 4; kind++) {
+        for (int s = 0; s < sizeof(sizes) / sizeof(unsigned int); s++) {
+            unsigned int size = sizes[s];
+            int *expected = (int*)malloc(sizeof(int) * (size + 1));
+            IntArray array = IntArrayCreate();
+            srand(size);
+            for (unsigned int i = 0; i < size; i++) {
+                int value;
+                switch (kind) {
+                    case 0: value = rand(); break;
+                    case 1: value = rand() % 5; break;
+                    case 2: value = (int)i; break;
+                    default: value = (int)(size - i); break;
+                }
+                expected[i] = value;
+                IntArrayAdd(array, value);
+            }
+            qsort(expected, size, sizeof(int), &compareIntQsort);
+            IntArraySort(array, &compareInt);
+            for (unsigned int i = 0; i < size; i++) {
+                CU_ASSERT_EQUAL_FATAL(IntArrayAt(array, i), expected[i]);
+            }
+            IntArrayDispose(array);
+            free(expected);
+        }
+    }
+
+    // Structures.
+    PointArray points = PointArrayCreate();
+    for (int i = 0; i < 100; i++) {
+        Point point = {(double)((i * 37) % 100), (double)i};
+        PointArrayAdd(points, point);
+    }
+    PointArraySort(points, &comparePoint);
+    for (int i = 0; i < 100; i++) {
+        CU_ASSERT_EQUAL_FATAL(PointArrayAt(points, i).x, (double)i);
+    }
+    PointArrayDispose(points);
+    muntrace();
+}
+
+void test_CX_ArrayDefineLowerBound() {
+    CX_UTEST_INIT_TEST("CX_ARRAY_DEFINE");
+    mtrace();
+
+    int key;
+    IntArray array = IntArrayCreate();
+    key = 5;
+    CU_ASSERT_EQUAL_FATAL(IntArrayLowerBound(array, &key, &compareInt), 0);
+    for (int i = 0; i < 100; i++) {
+        IntArrayAdd(array, 2 * (i / 2));
+    }
+    key = 10;
+    CU_ASSERT_EQUAL_FATAL(IntArrayLowerBound(array, &key, &compareInt), 10);
+    key = 11;
+    CU_ASSERT_EQUAL_FATAL(IntArrayLowerBound(array, &key, &compareInt), 12);
+    key = -1;
+    CU_ASSERT_EQUAL_FATAL(IntArrayLowerBound(array, &key, &compareInt), 0);
+    key = 1000;
+    CU_ASSERT_EQUAL_FATAL(IntArrayLowerBound(array, &key, &compareInt), 100);
+    IntArrayDispose(array);
+    muntrace();
+}
+
+int main (int argc, char *argv[])
+{
+    printf("\n=== %s ===\n", argv[0]);
+
+    void (*functions[])(void) = {
+        &test_CX_ArrayDefineAdd,
+        &test_CX_ArrayDefineInsertRemove,
+        &test_CX_ArrayDefineSort,
+        &test_CX_ArrayDefineLowerBound
+    };
+
+    CU_pSuite pSuite1 = NULL;
+
+    // Initialize CUnit test registry.
+    if (CUE_SUCCESS != CU_initialize_registry()) {
+        return CU_get_error();
+    }
+
+    // Add the first tests suite to registry.
+    pSuite1 = CU_add_suite("Test Suite #1", init_suite, clean_suite);
+    if (NULL == pSuite1) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // Add functions in the tests suite.
+    for (int i=0; i < sizeof(functions)/sizeof(void (*)(void)); i++) {
+        if ((NULL == CU_add_test(pSuite1, "\n\nTesting\n\n", functions[i]))) {
+            CU_cleanup_registry();
+            return CU_get_error();
+        }
+    }
+
+    // OUTPUT to the screen
+    CU_basic_run_tests();
+
+    //Cleaning the Registry
+    CU_cleanup_registry();
+
+    CX_UTEST_END_TEST_SUITE;
+}
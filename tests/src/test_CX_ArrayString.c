@@ -1,5 +1,6 @@
 #include <mcheck.h>
 #include <stdlib.h>
+#include <stdio.h>
 #include "CUnit/CUnit.h"
 #include "CUnit/Basic.h"
 #include "CX_UTest.h"
@@ -148,6 +149,87 @@ void test_CX_StringArrayDup() {
     muntrace();
 }
 
+void test_CX_ArrayStringDupParallel() {
+
+    CX_UTEST_INIT_TEST("CX_ArrayStringDupParallel");
+    mtrace();
+
+    CX_ArrayString array = CX_ArrayStringCreate(NULL);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+    char buffer[32];
+    for (int i=0; i<2000; i++) {
+        sprintf(buffer, "String %d", i);
+        CU_ASSERT_TRUE_FATAL(CX_ArrayStringAddCloneChar(array, buffer));
+    }
+
+    CX_Status status = CX_StatusCreate();
+    CX_ArrayString duplicatedArray = CX_ArrayStringDupParallel(array, 4, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(duplicatedArray);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CU_ASSERT_EQUAL(CX_ArrayStringGetCount(duplicatedArray), 2000);
+
+    for (int i=0; i<2000; i++) {
+        sprintf(buffer, "String %d", i);
+        CU_ASSERT_STRING_EQUAL_FATAL(buffer, SL_StringGetString(CX_ArrayStringGetStringAt(duplicatedArray, i)));
+    }
+
+    CX_StatusDispose(status);
+    CX_ArrayStringDispose(array);
+    CX_ArrayStringDispose(duplicatedArray);
+    muntrace();
+}
+
+void test_CX_ArrayStringLoadMapped() {
+
+    CX_UTEST_INIT_TEST("CX_ArrayStringLoadMapped");
+    mtrace();
+
+    const char *path = "/tmp/test_CX_ArrayStringLoadMapped.bin";
+    CX_ArrayString array = CX_ArrayStringCreate(NULL);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+    char buffer[32];
+    for (int i=0; i<2000; i++) {
+        sprintf(buffer, "String %d", i);
+        if (0 == i % 100) {
+            // Empty strings.
+            buffer[0] = 0;
+        }
+        CU_ASSERT_TRUE_FATAL(CX_ArrayStringAddCloneChar(array, buffer));
+    }
+
+    CX_Status status = CX_StatusCreate();
+    CU_ASSERT_TRUE_FATAL(CX_ArrayStringSave(array, path, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CX_ArrayStringDispose(array);
+
+    array = CX_ArrayStringLoadMapped(path, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayStringGetCount(array), 2000);
+    for (int i=0; i<2000; i++) {
+        sprintf(buffer, "String %d", i);
+        if (0 == i % 100) {
+            buffer[0] = 0;
+        }
+        CU_ASSERT_STRING_EQUAL_FATAL(buffer, SL_StringGetString(CX_ArrayStringGetStringAt(array, i)));
+    }
+
+    // The strings of a clone do not belong to the image.
+    CX_ArrayString duplicatedArray = CX_ArrayStringDup(array, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(duplicatedArray);
+    CX_ArrayStringDispose(array);
+    CU_ASSERT_TRUE_FATAL(CX_ArrayStringAppendChar(duplicatedArray, "!"));
+    CU_ASSERT_STRING_EQUAL_FATAL("String 1999!", SL_StringGetString(CX_ArrayStringGetStringAt(duplicatedArray, 1999)));
+    CX_ArrayStringDispose(duplicatedArray);
+
+    remove(path);
+    CU_ASSERT_PTR_NULL_FATAL(CX_ArrayStringLoadMapped(path, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
 void test_CX_StringArrayGetAt() {
 
     CX_UTEST_INIT_TEST("CX_StringArrayGetAt");
@@ -322,9 +404,11 @@ int main (int argc, char *argv[])
         &test_CX_StringArrayGetAt,
         &test_CX_StringArrayJoin,
         &test_CX_StringArrayDup,
+        &test_CX_ArrayStringDupParallel,
         &test_CX_ArrayStringGetStrings,
         &test_CX_ArrayStringPrependChar,
-        &test_CX_ArrayStringAppendChar
+        &test_CX_ArrayStringAppendChar,
+        &test_CX_ArrayStringLoadMapped
     };
 
     CU_pSuite pSuite1 = NULL;
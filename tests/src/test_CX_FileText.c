@@ -66,7 +66,7 @@ void test_CX_FileTextSlurpAsLines() {
     CX_ArrayStringDispose(lines);
     CX_FileTextDispose(testFile);
     CX_StatusDispose(status);
-    muntrace();
+    CX_UTEST_END_TEST();
 }
 
 
@@ -0,0 +1,214 @@
+#include <mcheck.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "CX_UTest.h"
+#include "CUnit/CUnit.h"
+#include "CUnit/Basic.h"
+#include "CX_Heap.h"
+
+#define ELEMENT_COUNT 1000
+
+// Define mandatory callbacks.
+int init_suite(void) {
+    CX_UTEST_INIT_ALL("src/CX_Heap.c");
+    return 0;
+}
+
+int clean_suite(void) {
+    return 0;
+}
+
+int compareInt(void *inA, void *inB, void *inContext) {
+    int a = *((int*)inA);
+    int b = *((int*)inB);
+    int direction = NULL == inContext ? 1 : *((int*)inContext);
+    return direction * (a < b ? -1 : (a > b ? 1 : 0));
+}
+
+void elementDisposer(void *inElement) {
+    free(inElement);
+}
+
+struct Task {
+    int priority;
+    size_t position;
+};
+
+int compareTask(void *inA, void *inB, void *inContext) {
+    return ((struct Task*)inA)->priority - ((struct Task*)inB)->priority;
+}
+
+void taskMoved(void *inTask, size_t inIndex, void *inContext) {
+    ((struct Task*)inTask)->position = inIndex;
+}
+
+void test_CX_HeapPushPop() {
+    CX_UTEST_INIT_TEST("CX_HeapPush");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int values[ELEMENT_COUNT];
+    srand(1);
+    for (int i = 0; i < ELEMENT_COUNT; i++) {
+        values[i] = rand() % 100;
+    }
+
+    // Min heap.
+    CX_Heap heap = CX_HeapCreate(&compareInt, NULL, NULL, NULL);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(heap);
+    CU_ASSERT_PTR_NULL_FATAL(CX_HeapPeek(heap));
+    CU_ASSERT_PTR_NULL_FATAL(CX_HeapPop(heap));
+    for (int i = 0; i < ELEMENT_COUNT; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_HeapPush(heap, values + i, status), values + i);
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_HeapGetCount(heap), ELEMENT_COUNT);
+    int previous = -1;
+    for (int i = 0; i < ELEMENT_COUNT; i++) {
+        int *peeked = (int*)CX_HeapPeek(heap);
+        int *popped = (int*)CX_HeapPop(heap);
+        CU_ASSERT_EQUAL_FATAL(peeked, popped);
+        CU_ASSERT_TRUE_FATAL(*popped >= previous);
+        previous = *popped;
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_HeapGetCount(heap), 0);
+    CX_HeapDispose(heap);
+
+    // Max heap, which elements are disposed with the heap.
+    int descending = -1;
+    heap = CX_HeapCreate(&compareInt, &descending, &elementDisposer, NULL);
+    for (int i = 0; i < ELEMENT_COUNT; i++) {
+        int *value = (int*)malloc(sizeof(int));
+        *value = values[i];
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_HeapPush(heap, value, status));
+    }
+    previous = 100;
+    for (int i = 0; i < ELEMENT_COUNT / 2; i++) {
+        int *popped = (int*)CX_HeapPop(heap);
+        CU_ASSERT_TRUE_FATAL(*popped <= previous);
+        previous = *popped;
+        free(popped);
+    }
+    CX_HeapDispose(heap);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_HeapPushMany() {
+    CX_UTEST_INIT_TEST("CX_HeapPushMany");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int values[ELEMENT_COUNT];
+    void *pointers[ELEMENT_COUNT];
+    for (int i = 0; i < ELEMENT_COUNT; i++) {
+        values[i] = (i * 7919) % ELEMENT_COUNT;
+        pointers[i] = values + i;
+    }
+
+    // Heapify, then push a few elements one by one.
+    CX_Heap heap = CX_HeapCreate(&compareInt, NULL, NULL, NULL);
+    CU_ASSERT_TRUE_FATAL(CX_HeapPushMany(heap, pointers, ELEMENT_COUNT - 10, status));
+    CU_ASSERT_TRUE_FATAL(CX_HeapPushMany(heap, pointers + ELEMENT_COUNT - 10, 10, status));
+    CU_ASSERT_TRUE_FATAL(CX_HeapPushMany(heap, pointers, 0, status));
+    CU_ASSERT_EQUAL_FATAL(CX_HeapGetCount(heap), ELEMENT_COUNT);
+    for (int i = 0; i < ELEMENT_COUNT; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_HeapPop(heap), i);
+    }
+    CX_HeapDispose(heap);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_HeapDecreaseKey() {
+    CX_UTEST_INIT_TEST("CX_HeapDecreaseKey");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    struct Task tasks[ELEMENT_COUNT];
+    void *pointers[ELEMENT_COUNT];
+    for (int i = 0; i < ELEMENT_COUNT; i++) {
+        tasks[i].priority = 1000 + (i * 31) % ELEMENT_COUNT;
+        tasks[i].position = SIZE_MAX;
+        pointers[i] = tasks + i;
+    }
+
+    CX_Heap heap = CX_HeapCreate(&compareTask, NULL, NULL, NULL);
+    CX_HeapSetPositionTracker(heap, &taskMoved);
+    CU_ASSERT_TRUE_FATAL(CX_HeapPushMany(heap, pointers, ELEMENT_COUNT / 2, status));
+    for (int i = ELEMENT_COUNT / 2; i < ELEMENT_COUNT; i++) {
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_HeapPush(heap, tasks + i, status));
+    }
+    for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_HeapGetElementAt(heap, tasks[i].position), tasks + i);
+    }
+
+    // Move a task to the front of the queue.
+    tasks[500].priority = 0;
+    CU_ASSERT_TRUE_FATAL(CX_HeapDecreaseKey(heap, tasks[500].position));
+    CU_ASSERT_EQUAL_FATAL(CX_HeapPeek(heap), tasks + 500);
+    CU_ASSERT_EQUAL_FATAL(tasks[500].position, 0);
+
+    // Move it to the back.
+    tasks[500].priority = 5000;
+    CU_ASSERT_TRUE_FATAL(CX_HeapUpdateAt(heap, 0));
+    CU_ASSERT_FALSE_FATAL(CX_HeapUpdateAt(heap, ELEMENT_COUNT));
+    CU_ASSERT_FALSE_FATAL(CX_HeapDecreaseKey(heap, ELEMENT_COUNT));
+    for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_HeapGetElementAt(heap, tasks[i].position), tasks + i);
+    }
+
+    int previous = 0;
+    for (int i = 0; i < ELEMENT_COUNT; i++) {
+        struct Task *task = (struct Task*)CX_HeapPop(heap);
+        CU_ASSERT_TRUE_FATAL(task->priority >= previous);
+        previous = task->priority;
+    }
+    CU_ASSERT_EQUAL_FATAL(previous, 5000);
+    CX_HeapDispose(heap);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+int main (int argc, char *argv[])
+{
+    printf("\n=== %s ===\n", argv[0]);
+
+    void (*functions[])(void) = {
+        &test_CX_HeapPushPop,
+        &test_CX_HeapPushMany,
+        &test_CX_HeapDecreaseKey
+    };
+
+    CU_pSuite pSuite1 = NULL;
+
+    // Initialize CUnit test registry.
+    if (CUE_SUCCESS != CU_initialize_registry()) {
+        return CU_get_error();
+    }
+
+    // Add the first tests suite to registry.
+    pSuite1 = CU_add_suite("Test Suite #1", init_suite, clean_suite);
+    if (NULL == pSuite1) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // Add functions in the tests suite.
+    for (int i=0; i < sizeof(functions)/sizeof(void (*)(void)); i++) {
+        if ((NULL == CU_add_test(pSuite1, "\n\nTesting\n\n", functions[i]))) {
+            CU_cleanup_registry();
+            return CU_get_error();
+        }
+    }
+
+    // OUTPUT to the screen
+    CU_basic_run_tests();
+
+    //Cleaning the Registry
+    CU_cleanup_registry();
+
+    CX_UTEST_END_TEST_SUITE;
+}
@@ -59,7 +59,7 @@ void test_CX_LoggerLog() {
 
     CX_StatusDispose(status);
     CX_LoggerDispose(logger);
-    muntrace();
+    CX_UTEST_END_TEST();
 }
 
 void test_CX_LoggerLogFatal() {
@@ -0,0 +1,132 @@
+#include <mcheck.h>
+#include <stdlib.h>
+#include "CX_UTest.h"
+#include "CUnit/CUnit.h"
+#include "CUnit/Basic.h"
+#include "CX_Parallel.h"
+
+#define TASK_COUNT 8
+
+// Define mandatory callbacks.
+int init_suite(void) {
+    CX_UTEST_INIT_ALL("src/CX_Parallel.c");
+    return 0;
+}
+
+int clean_suite(void) {
+    return 0;
+}
+
+void task(unsigned int inIndex, unsigned int inCount, void *inContext) {
+    int *executions = (int*)inContext;
+    executions[inIndex] += (int)inCount;
+}
+
+void test_CX_ParallelRun() {
+    CX_UTEST_INIT_TEST("CX_ParallelRun");
+    mtrace();
+
+    for (unsigned int count = 0; count <= TASK_COUNT; count++) {
+        int executions[TASK_COUNT] = {0};
+        CX_ParallelRun(count, &task, executions);
+        for (unsigned int i = 0; i < TASK_COUNT; i++) {
+            CU_ASSERT_EQUAL_FATAL(executions[i], i < count ? (int)count : 0);
+        }
+    }
+    muntrace();
+}
+
+void nestedTask(unsigned int inIndex, unsigned int inCount, void *inContext) {
+    int (*executions)[TASK_COUNT] = (int(*)[TASK_COUNT])inContext;
+    CX_ParallelRun(TASK_COUNT, &task, executions[inIndex]);
+}
+
+void test_CX_ParallelRunNested() {
+    CX_UTEST_INIT_TEST("CX_ParallelRun");
+    mtrace();
+
+    // The workers are reused, and a task may run tasks.
+    for (int run = 0; run < 100; run++) {
+        int executions[TASK_COUNT][TASK_COUNT] = {{0}};
+        CX_ParallelRun(TASK_COUNT, &nestedTask, executions);
+        for (unsigned int i = 0; i < TASK_COUNT; i++) {
+            for (unsigned int j = 0; j < TASK_COUNT; j++) {
+                CU_ASSERT_EQUAL_FATAL(executions[i][j], TASK_COUNT);
+            }
+        }
+    }
+    muntrace();
+}
+
+void test_CX_ParallelGetThreadCount() {
+    CX_UTEST_INIT_TEST("CX_ParallelGetThreadCount");
+    mtrace();
+
+    CU_ASSERT_EQUAL_FATAL(CX_ParallelGetThreadCount(4, 1000000, 1000), 4);
+    CU_ASSERT_EQUAL_FATAL(CX_ParallelGetThreadCount(4, 2500, 1000), 2);
+    CU_ASSERT_EQUAL_FATAL(CX_ParallelGetThreadCount(4, 10, 1000), 1);
+    CU_ASSERT_EQUAL_FATAL(CX_ParallelGetThreadCount(4, 0, 1000), 1);
+    CU_ASSERT_TRUE_FATAL(CX_ParallelGetThreadCount(0, 1000000, 1) >= 1);
+    muntrace();
+}
+
+void test_CX_ParallelGetRange() {
+    CX_UTEST_INIT_TEST("CX_ParallelGetRange");
+    mtrace();
+
+    size_t begin, end;
+    size_t expected = 0;
+    for (unsigned int i = 0; i < 3; i++) {
+        CX_ParallelGetRange(10, i, 3, &begin, &end);
+        CU_ASSERT_EQUAL_FATAL(begin, expected);
+        CU_ASSERT_TRUE_FATAL(end - begin == 3 || end - begin == 4);
+        expected = end;
+    }
+    CU_ASSERT_EQUAL_FATAL(expected, 10);
+
+    CX_ParallelGetRange(2, 3, 4, &begin, &end);
+    CU_ASSERT_EQUAL_FATAL(begin, end);
+    muntrace();
+}
+
+int main (int argc, char *argv[])
+{
+    printf("\n=== %s ===\n", argv[0]);
+
+    void (*functions[])(void) = {
+        &test_CX_ParallelRun,
+        &test_CX_ParallelRunNested,
+        &test_CX_ParallelGetThreadCount,
+        &test_CX_ParallelGetRange
+    };
+
+    CU_pSuite pSuite1 = NULL;
+
+    // Initialize CUnit test registry.
+    if (CUE_SUCCESS != CU_initialize_registry()) {
+        return CU_get_error();
+    }
+
+    // Add the first tests suite to registry.
+    pSuite1 = CU_add_suite("Test Suite #1", init_suite, clean_suite);
+    if (NULL == pSuite1) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // Add functions in the tests suite.
+    for (int i=0; i < sizeof(functions)/sizeof(void (*)(void)); i++) {
+        if ((NULL == CU_add_test(pSuite1, "\n\nTesting\n\n", functions[i]))) {
+            CU_cleanup_registry();
+            return CU_get_error();
+        }
+    }
+
+    // OUTPUT to the screen
+    CU_basic_run_tests();
+
+    //Cleaning the Registry
+    CU_cleanup_registry();
+
+    CX_UTEST_END_TEST_SUITE;
+}
@@ -0,0 +1,236 @@
+#include <mcheck.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "CX_UTest.h"
+#include "CUnit/CUnit.h"
+#include "CUnit/Basic.h"
+#include "CX_String.h"
+#include "CX_ArrayString.h"
+#include "CX_Regex.h"
+
+#define CONCURRENT_THREADS 8
+#define CONCURRENT_LOOKUPS 2000
+
+// Define mandatory callbacks.
+int init_suite(void) {
+    CX_UTEST_INIT_ALL("src/CX_Regex.c");
+    return 0;
+}
+
+int clean_suite(void) {
+    return 0;
+}
+
+void test_CX_RegexMatch() {
+    CX_UTEST_INIT_TEST("CX_RegexMatch");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    CX_Regex regex = CX_RegexCreate("[0-9]+", REG_EXTENDED, status);
+    CU_ASSERT_NOT_EQUAL_FATAL(regex, NULL);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    CU_ASSERT_STRING_EQUAL_FATAL(CX_RegexGetPattern(regex), "[0-9]+");
+
+    size_t start, end;
+    CU_ASSERT_TRUE_FATAL(CX_RegexMatch(regex, "abc 1234 def", &start, &end));
+    CU_ASSERT_EQUAL_FATAL(start, 4);
+    CU_ASSERT_EQUAL_FATAL(end, 8);
+    CU_ASSERT_TRUE_FATAL(CX_RegexMatch(regex, "12", NULL, NULL));
+    CU_ASSERT_FALSE_FATAL(CX_RegexMatch(regex, "abc", &start, &end));
+    CX_RegexDispose(regex);
+
+    // Flags are taken into account.
+    regex = CX_RegexCreate("abc", REG_EXTENDED|REG_ICASE, status);
+    CU_ASSERT_TRUE_FATAL(CX_RegexMatch(regex, "xABCx", &start, &end));
+    CU_ASSERT_EQUAL_FATAL(start, 1);
+    CX_RegexDispose(regex);
+
+    // Invalid regex.
+    regex = CX_RegexCreate("(", REG_EXTENDED, status);
+    CU_ASSERT_PTR_NULL_FATAL(regex);
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_RegexCache() {
+    CX_UTEST_INIT_TEST("CX_RegexGetCached");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    CX_RegexCacheClear();
+    CU_ASSERT_EQUAL_FATAL(CX_RegexCacheGetCount(), 0);
+
+    // The same regex is returned for the same pattern and the same flags.
+    CX_Regex first = CX_RegexGetCached("\r?\n", REG_EXTENDED, status);
+    CU_ASSERT_NOT_EQUAL_FATAL(first, NULL);
+    CX_Regex second = CX_RegexGetCached("\r?\n", REG_EXTENDED, status);
+    CU_ASSERT_EQUAL_FATAL(first, second);
+    CX_Regex other = CX_RegexGetCached("\r?\n", REG_EXTENDED|REG_ICASE, status);
+    CU_ASSERT_NOT_EQUAL_FATAL(first, other);
+    CU_ASSERT_EQUAL_FATAL(CX_RegexCacheGetCount(), 2);
+    CX_RegexDispose(second);
+    CX_RegexDispose(other);
+
+    // Invalid regexes are not cached.
+    CU_ASSERT_PTR_NULL_FATAL(CX_RegexGetCached("(", REG_EXTENDED, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CU_ASSERT_EQUAL_FATAL(CX_RegexCacheGetCount(), 2);
+
+    // Fill the cache: the least recently used regexes are evicted, but "first" is still valid.
+    char pattern[32];
+    for (int i=0; i<200; i++) {
+        sprintf(pattern, "a{%d}", i + 1);
+        CX_Regex regex = CX_RegexGetCached(pattern, REG_EXTENDED, status);
+        CU_ASSERT_NOT_EQUAL_FATAL(regex, NULL);
+        CX_RegexDispose(regex);
+        CU_ASSERT_TRUE_FATAL(CX_RegexCacheGetCount() <= 64);
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_RegexCacheGetCount(), 64);
+    CU_ASSERT_TRUE_FATAL(CX_RegexMatch(first, "abc\r\ndef", NULL, NULL));
+
+    // The most recently used regexes are kept.
+    CX_Regex recent = CX_RegexGetCached("a{200}", REG_EXTENDED, status);
+    CX_Regex again = CX_RegexGetCached("a{200}", REG_EXTENDED, status);
+    CU_ASSERT_EQUAL_FATAL(recent, again);
+    CX_RegexDispose(recent);
+    CX_RegexDispose(again);
+
+    CX_RegexCacheClear();
+    CU_ASSERT_EQUAL_FATAL(CX_RegexCacheGetCount(), 0);
+    CU_ASSERT_TRUE_FATAL(CX_RegexMatch(first, "abc\ndef", NULL, NULL));
+    CX_RegexDispose(first);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void *concurrentLookup(void *inContext) {
+    long failures = 0;
+    char pattern[32];
+    char subject[81];
+    memset(subject, 'x', 80);
+    subject[80] = 0;
+    CX_Status status = CX_StatusCreate();
+    for (int i=0; i<CONCURRENT_LOOKUPS; i++) {
+        sprintf(pattern, "x{%d}", i % 80 + 1);
+        CX_Regex regex = CX_RegexGetCached(pattern, REG_EXTENDED, status);
+        if (NULL == regex || 0 != strcmp(CX_RegexGetPattern(regex), pattern) ||
+            ! CX_RegexMatch(regex, subject, NULL, NULL)) {
+            failures++;
+        }
+        if (NULL != regex) {
+            CX_RegexDispose(regex);
+        }
+    }
+    CX_StatusDispose(status);
+    return (void*)failures;
+}
+
+void test_CX_RegexCacheConcurrent() {
+    CX_UTEST_INIT_TEST("CX_RegexGetCached");
+    mtrace();
+
+    // 80 patterns for 64 slots: the threads keep adding and evicting regexes.
+    pthread_t threads[CONCURRENT_THREADS];
+    for (int i=0; i<CONCURRENT_THREADS; i++) {
+        CU_ASSERT_EQUAL_FATAL(pthread_create(threads + i, NULL, &concurrentLookup, NULL), 0);
+    }
+    for (int i=0; i<CONCURRENT_THREADS; i++) {
+        void *failures;
+        CU_ASSERT_EQUAL_FATAL(pthread_join(threads[i], &failures), 0);
+        CU_ASSERT_EQUAL_FATAL((long)failures, 0);
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_RegexCacheGetCount(), 64);
+
+    CX_RegexCacheClear();
+    muntrace();
+}
+
+void test_CX_RegexSplitReplace() {
+    CX_UTEST_INIT_TEST("CX_RegexSplit");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    CX_Regex regex = CX_RegexCreate("\r?\n", REG_EXTENDED, status);
+    CX_String string = CX_StringCreate("ABC\r\nDEF\nGHI\n");
+
+    CX_ArrayString array = CX_RegexSplit(regex, string, status);
+    CU_ASSERT_NOT_EQUAL_FATAL(array, NULL);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayStringGetCount(array), 4);
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(CX_ArrayStringGetStringAt(array, 0)), "ABC");
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(CX_ArrayStringGetStringAt(array, 1)), "DEF");
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(CX_ArrayStringGetStringAt(array, 2)), "GHI");
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(CX_ArrayStringGetStringAt(array, 3)), "");
+    CX_ArrayStringDispose(array);
+
+    CX_SplitIndex index = CX_SplitIndexCreate();
+    CU_ASSERT_TRUE_FATAL(CX_RegexSplitIndex(regex, string, index, status));
+    CU_ASSERT_EQUAL_FATAL(CX_SplitIndexGetCount(index), 4);
+    CU_ASSERT_EQUAL_FATAL(CX_SplitIndexGetTokens(index)[1].offset, 5);
+    CU_ASSERT_EQUAL_FATAL(CX_SplitIndexGetTokens(index)[1].length, 3);
+    CX_SplitIndexDispose(index);
+
+    CX_String result = CX_RegexReplace(regex, string, "|", status);
+    CU_ASSERT_NOT_EQUAL_FATAL(result, NULL);
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(result), "ABC|DEF|GHI|");
+    CX_StringDispose(result);
+    CX_RegexDispose(regex);
+
+    // A regex that matches the empty string does not split the string any further.
+    regex = CX_RegexCreate("x*", REG_EXTENDED, status);
+    array = CX_RegexSplit(regex, string, status);
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayStringGetCount(array), 1);
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(CX_ArrayStringGetStringAt(array, 0)), SL_StringGetString(string));
+    CX_ArrayStringDispose(array);
+    CX_RegexDispose(regex);
+
+    CX_StringDispose(string);
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+int main (int argc, char *argv[])
+{
+    printf("\n=== %s ===\n", argv[0]);
+
+    void (*functions[])(void) = {
+        &test_CX_RegexMatch,
+        &test_CX_RegexCache,
+        &test_CX_RegexCacheConcurrent,
+        &test_CX_RegexSplitReplace
+    };
+
+    CU_pSuite pSuite1 = NULL;
+
+    // Initialize CUnit test registry.
+    if (CUE_SUCCESS != CU_initialize_registry()) {
+        return CU_get_error();
+    }
+
+    // Add the first tests suite to registry.
+    pSuite1 = CU_add_suite("Test Suite #1", init_suite, clean_suite);
+    if (NULL == pSuite1) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // Add functions in the tests suite.
+    for (int i=0; i < sizeof(functions)/sizeof(void (*)(void)); i++) {
+        if ((NULL == CU_add_test(pSuite1, "\n\nTesting\n\n", functions[i]))) {
+            CU_cleanup_registry();
+            return CU_get_error();
+        }
+    }
+
+    // OUTPUT to the screen
+    CU_basic_run_tests();
+
+    //Cleaning the Registry
+    CU_cleanup_registry();
+
+    CX_UTEST_END_TEST_SUITE;
+}
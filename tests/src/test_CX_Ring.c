@@ -0,0 +1,245 @@
+#include <mcheck.h>
+#include <stdlib.h>
+#include <errno.h>
+#include "CX_UTest.h"
+#include "CUnit/CUnit.h"
+#include "CUnit/Basic.h"
+#include "CX_Ring.h"
+
+#define ELEMENT_COUNT 1000
+
+// Define mandatory callbacks.
+int init_suite(void) {
+    CX_UTEST_INIT_ALL("src/CX_Ring.c");
+    return 0;
+}
+
+int clean_suite(void) {
+    return 0;
+}
+
+void elementDisposer(void *inElement) {
+    free(inElement);
+}
+
+void *elementCloner(void *inElement, CX_Status outStatus) {
+    int *element = (int*)malloc(sizeof(int));
+    if (NULL == element) {
+        CX_StatusSetError(outStatus, errno, "Cannot allocated memory!");
+        return NULL;
+    }
+    *element = *((int*)inElement);
+    return (void*)element;
+}
+
+void test_CX_RingEnqueueDequeue() {
+    CX_UTEST_INIT_TEST("CX_RingEnqueue");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int values[ELEMENT_COUNT];
+    for (int i = 0; i < ELEMENT_COUNT; i++) {
+        values[i] = i;
+    }
+
+    // A fixed size ring.
+    CX_Ring ring = CX_RingCreate(10, false, NULL, NULL);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(ring);
+    CU_ASSERT_EQUAL_FATAL(CX_RingGetCapacity(ring), 16);
+    CU_ASSERT_PTR_NULL_FATAL(CX_RingDequeue(ring));
+    CU_ASSERT_PTR_NULL_FATAL(CX_RingPeek(ring));
+    for (int i = 0; i < 16; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_RingEnqueue(ring, values + i, status), values + i);
+    }
+    CU_ASSERT_PTR_NULL_FATAL(CX_RingEnqueue(ring, values, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+
+    // The elements wrap around the end of the buffer.
+    int next = 16;
+    for (int i = 0; i < ELEMENT_COUNT - 16; i++) {
+        CU_ASSERT_EQUAL_FATAL(CX_RingDequeue(ring), values + i);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_RingEnqueue(ring, values + next++, status));
+        CU_ASSERT_EQUAL_FATAL(CX_RingPeek(ring), values + i + 1);
+        CU_ASSERT_EQUAL_FATAL(CX_RingGetElementAt(ring, 15), values + next - 1);
+    }
+    CU_ASSERT_PTR_NULL_FATAL(CX_RingGetElementAt(ring, 16));
+    CU_ASSERT_EQUAL_FATAL(CX_RingGetCapacity(ring), 16);
+    CX_RingDispose(ring);
+
+    // A growable ring keeps the order of the elements.
+    ring = CX_RingCreate(0, true, &elementDisposer, NULL);
+    CU_ASSERT_EQUAL_FATAL(CX_RingGetCapacity(ring), 8);
+    for (int i = 0; i < 5; i++) {
+        int *value = (int*)malloc(sizeof(int));
+        *value = i;
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_RingEnqueue(ring, value, status));
+    }
+    for (int i = 0; i < 3; i++) {
+        free(CX_RingDequeue(ring));
+    }
+    for (int i = 5; i < ELEMENT_COUNT; i++) {
+        int *value = (int*)malloc(sizeof(int));
+        *value = i;
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_RingEnqueue(ring, value, status));
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_RingGetCount(ring), ELEMENT_COUNT - 3);
+    CU_ASSERT_EQUAL_FATAL(CX_RingGetCapacity(ring), 1024);
+    for (size_t i = 0; i < ELEMENT_COUNT - 3; i++) {
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_RingGetElementAt(ring, i), (int)i + 3);
+    }
+    // The remaining elements are disposed.
+    CX_RingDispose(ring);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_RingBatch() {
+    CX_UTEST_INIT_TEST("CX_RingEnqueueMany");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    int values[ELEMENT_COUNT];
+    void *pointers[ELEMENT_COUNT];
+    void *dequeued[ELEMENT_COUNT];
+    for (int i = 0; i < ELEMENT_COUNT; i++) {
+        values[i] = i;
+        pointers[i] = values + i;
+    }
+
+    CX_Ring ring = CX_RingCreate(64, false, NULL, NULL);
+    CU_ASSERT_TRUE_FATAL(CX_RingEnqueueMany(ring, pointers, 40, status));
+    CU_ASSERT_FALSE_FATAL(CX_RingEnqueueMany(ring, pointers, 25, status));
+    CU_ASSERT_EQUAL_FATAL(CX_RingGetCount(ring), 40);
+    CU_ASSERT_TRUE_FATAL(CX_RingEnqueueMany(ring, pointers, 0, status));
+
+    // Batches that wrap around the end of the buffer.
+    size_t expected = 0, added = 40;
+    for (int round = 0; round < 20; round++) {
+        CU_ASSERT_EQUAL_FATAL(CX_RingDequeueMany(ring, dequeued, 30), 30);
+        for (size_t i = 0; i < 30; i++) {
+            CU_ASSERT_EQUAL_FATAL(dequeued[i], pointers[expected++ % ELEMENT_COUNT]);
+        }
+        void *batch[30];
+        for (size_t i = 0; i < 30; i++) {
+            batch[i] = pointers[added++ % ELEMENT_COUNT];
+        }
+        CU_ASSERT_TRUE_FATAL(CX_RingEnqueueMany(ring, batch, 30, status));
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_RingDequeueMany(ring, dequeued, ELEMENT_COUNT), 40);
+    CU_ASSERT_EQUAL_FATAL(CX_RingDequeueMany(ring, dequeued, ELEMENT_COUNT), 0);
+    CX_RingDispose(ring);
+
+    // A growable ring.
+    ring = CX_RingCreate(8, true, NULL, NULL);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_RingEnqueue(ring, values, status));
+    CU_ASSERT_PTR_NOT_NULL_FATAL(CX_RingDequeue(ring));
+    CU_ASSERT_TRUE_FATAL(CX_RingEnqueueMany(ring, pointers, ELEMENT_COUNT, status));
+    CU_ASSERT_EQUAL_FATAL(CX_RingGetCapacity(ring), 1024);
+    CU_ASSERT_EQUAL_FATAL(CX_RingDequeueMany(ring, dequeued, ELEMENT_COUNT), ELEMENT_COUNT);
+    for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+        CU_ASSERT_EQUAL_FATAL(dequeued[i], pointers[i]);
+    }
+    CX_RingDispose(ring);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+void test_CX_RingDup() {
+    CX_UTEST_INIT_TEST("CX_RingDup");
+    mtrace();
+
+    CX_Status status = CX_StatusCreate();
+    CX_Ring ring = CX_RingCreate(8, false, &elementDisposer, &elementCloner);
+    for (int i = 0; i < 12; i++) {
+        int *value = (int*)malloc(sizeof(int));
+        *value = i;
+        if (i >= 8) {
+            free(CX_RingDequeue(ring));
+        }
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_RingEnqueue(ring, value, status));
+    }
+
+    CX_Ring clone = CX_RingDup(ring, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(clone);
+    CU_ASSERT_EQUAL_FATAL(CX_RingGetCount(clone), 8);
+    for (size_t i = 0; i < 8; i++) {
+        CU_ASSERT_NOT_EQUAL_FATAL(CX_RingGetElementAt(clone, i), CX_RingGetElementAt(ring, i));
+        CU_ASSERT_EQUAL_FATAL(*(int*)CX_RingGetElementAt(clone, i), (int)i + 4);
+    }
+    CX_RingClear(ring);
+    CU_ASSERT_EQUAL_FATAL(CX_RingGetCount(ring), 0);
+    CX_RingDispose(ring);
+    CX_RingDispose(clone);
+
+    // A fixed-size ring keeps its capacity when it is cloned.
+    ring = CX_RingCreate(64, false, &elementDisposer, &elementCloner);
+    for (int i = 0; i < 3; i++) {
+        int *value = (int*)malloc(sizeof(int));
+        *value = i;
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_RingEnqueue(ring, value, status));
+    }
+    clone = CX_RingDup(ring, status);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(clone);
+    CU_ASSERT_EQUAL_FATAL(CX_RingGetCapacity(clone), 64);
+    for (int i = 3; i < 64; i++) {
+        int *value = (int*)malloc(sizeof(int));
+        *value = i;
+        CU_ASSERT_PTR_NOT_NULL_FATAL(CX_RingEnqueue(clone, value, status));
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_RingGetCount(clone), 64);
+    CU_ASSERT_EQUAL_FATAL(*(int*)CX_RingGetElementAt(clone, 63), 63);
+    CX_RingDispose(ring);
+    CX_RingDispose(clone);
+
+    // A ring without cloner cannot be cloned.
+    ring = CX_RingCreate(8, false, NULL, NULL);
+    CU_ASSERT_PTR_NULL_FATAL(CX_RingDup(ring, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CX_RingDispose(ring);
+
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+int main (int argc, char *argv[])
+{
+    printf("\n=== %s ===\n", argv[0]);
+
+    void (*functions[])(void) = {
+        &test_CX_RingEnqueueDequeue,
+        &test_CX_RingBatch,
+        &test_CX_RingDup
+    };
+
+    CU_pSuite pSuite1 = NULL;
+
+    // Initialize CUnit test registry.
+    if (CUE_SUCCESS != CU_initialize_registry()) {
+        return CU_get_error();
+    }
+
+    // Add the first tests suite to registry.
+    pSuite1 = CU_add_suite("Test Suite #1", init_suite, clean_suite);
+    if (NULL == pSuite1) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // Add functions in the tests suite.
+    for (int i=0; i < sizeof(functions)/sizeof(void (*)(void)); i++) {
+        if ((NULL == CU_add_test(pSuite1, "\n\nTesting\n\n", functions[i]))) {
+            CU_cleanup_registry();
+            return CU_get_error();
+        }
+    }
+
+    // OUTPUT to the screen
+    CU_basic_run_tests();
+
+    //Cleaning the Registry
+    CU_cleanup_registry();
+
+    CX_UTEST_END_TEST_SUITE;
+}
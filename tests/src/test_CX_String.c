@@ -231,6 +231,81 @@ void test_CX_StringAppendChar() {
     muntrace();
 }
 
+void test_CX_StringAppendGrowth() {
+
+    CX_UTEST_INIT_TEST("CX_StringAppendGrowth");
+    mtrace();
+
+    // The length is kept up to date while the buffer grows.
+    CX_String string = CX_StringCreate(NULL);
+    CU_ASSERT_EQUAL_FATAL(CX_StringLength(string), 0);
+    for (int i=0; i<100000; i++) {
+        CU_ASSERT_TRUE_FATAL(CX_StringAppendChar(string, "0123456789"));
+    }
+    CU_ASSERT_EQUAL_FATAL(CX_StringLength(string), 1000000);
+    CU_ASSERT_EQUAL_FATAL(strlen(SL_StringGetString(string)), 1000000);
+    CU_ASSERT_EQUAL_FATAL(strncmp(SL_StringGetString(string) + 999990, "0123456789", 10), 0);
+    CX_StringDispose(string);
+
+    // A String object can be appended (or prepended) to itself.
+    string = CX_StringCreate("abc");
+    CU_ASSERT_TRUE_FATAL(CX_StringAppend(string, string));
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(string), "abcabc");
+    CU_ASSERT_TRUE_FATAL(CX_StringPrependChar(string, SL_StringGetString(string) + 4));
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(string), "bcabcabc");
+    CU_ASSERT_TRUE_FATAL(CX_StringPrepend(string, string));
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(string), "bcabcabcbcabcabc");
+    CU_ASSERT_EQUAL_FATAL(CX_StringLength(string), 16);
+
+    // The clone keeps the length.
+    CX_String clone = CX_StringDup(string);
+    CU_ASSERT_EQUAL_FATAL(CX_StringLength(clone), 16);
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(clone), "bcabcabcbcabcabc");
+    CX_StringDispose(clone);
+    CX_StringDispose(string);
+    muntrace();
+}
+
+void test_CX_StringSmall() {
+
+    CX_UTEST_INIT_TEST("CX_StringSmall");
+    mtrace();
+
+    // A short string is stored within the String object.
+    CX_String string = CX_StringCreate("abc");
+    struct CX_StringType *header = (struct CX_StringType*)string;
+    CU_ASSERT_EQUAL_FATAL(SL_StringGetString(string), header->small);
+    CX_String clone = CX_StringDup(string);
+    CU_ASSERT_EQUAL_FATAL(SL_StringGetString(clone), ((struct CX_StringType*)clone)->small);
+    CX_StringDispose(clone);
+
+    // It moves to the heap when it grows out of the small buffer.
+    CU_ASSERT_TRUE_FATAL(CX_StringAppendChar(string, "defghijklmnopqrstuvw"));
+    CU_ASSERT_EQUAL_FATAL(SL_StringGetString(string), header->small);
+    CU_ASSERT_TRUE_FATAL(CX_StringAppendChar(string, "xyz"));
+    CU_ASSERT_NOT_EQUAL_FATAL(SL_StringGetString(string), header->small);
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(string), "abcdefghijklmnopqrstuvwxyz");
+    CU_ASSERT_TRUE_FATAL(CX_StringPrependChar(string, "0123456789"));
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(string), "0123456789abcdefghijklmnopqrstuvwxyz");
+    CU_ASSERT_EQUAL_FATAL(CX_StringLength(string), 36);
+    CX_StringDispose(string);
+
+    // An empty String object uses its small buffer as soon as characters are added.
+    string = CX_StringCreate(NULL);
+    header = (struct CX_StringType*)string;
+    CU_ASSERT_PTR_NULL_FATAL(SL_StringGetString(string));
+    CU_ASSERT_TRUE_FATAL(CX_StringPrependChar(string, "abc"));
+    CU_ASSERT_EQUAL_FATAL(SL_StringGetString(string), header->small);
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(string), "abc");
+    CX_StringDispose(string);
+
+    // A long string is allocated.
+    string = CX_StringCreate("abcdefghijklmnopqrstuvwxyz");
+    CU_ASSERT_NOT_EQUAL_FATAL(SL_StringGetString(string), ((struct CX_StringType*)string)->small);
+    CX_StringDispose(string);
+    muntrace();
+}
+
 void test_CX_StringPrepend() {
 
     CX_UTEST_INIT_TEST("CX_StringPrepend");
@@ -387,6 +462,52 @@ void test_CX_StringSplitChar() {
 }
 
 
+void test_CX_StringSplitCharSearch() {
+
+    CX_UTEST_INIT_TEST("CX_StringSplitCharSearch");
+    mtrace();
+
+    // Build a long text, so that the delimiters appear at every position within the SIMD blocks.
+    char *pieces[] = { "a", "ab", "abab", "aab", "\xff\xfe", ";", "", "xyzxyzxyzxyzxyzxyzxyzxyzxyzxyzxyzxyzxyzxyz" };
+    char *delimiters[] = { ";", "\xff", "b", "ab", "aab", "abab", "\xff\xfe", "xyzx", "not found" };
+    CX_String string = CX_StringCreate(NULL);
+    for (int i=0; i<2000; i++) {
+        CU_ASSERT_TRUE_FATAL(CX_StringAppendChar(string, pieces[(i * 7 + i / 5) % (sizeof(pieces)/sizeof(char*))]));
+    }
+
+    for (int i=0; i<sizeof(delimiters)/sizeof(char*); i++) {
+        CX_ArrayString array = CX_StringSplitChar(string, delimiters[i]);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+
+        // The tokens must be the tokens found by strstr().
+        char *pool = SL_StringGetString(string);
+        size_t count = 0;
+        for (;;) {
+            char *beginning = strstr(pool, delimiters[i]);
+            size_t length = NULL == beginning ? strlen(pool) : (size_t)(beginning - pool);
+            CU_ASSERT_TRUE_FATAL(count < CX_ArrayStringGetCount(array));
+            CX_String token = CX_ArrayStringGetStringAt(array, count++);
+            CU_ASSERT_EQUAL_FATAL(CX_StringLength(token), length);
+            CU_ASSERT_EQUAL_FATAL(strncmp(SL_StringGetString(token), pool, length), 0);
+            if (NULL == beginning) {
+                break;
+            }
+            pool = beginning + strlen(delimiters[i]);
+        }
+        CU_ASSERT_EQUAL_FATAL(CX_ArrayStringGetCount(array), count);
+        CX_ArrayStringDispose(array);
+    }
+
+    // An empty delimiter does not split the string.
+    CX_ArrayString array = CX_StringSplitChar(string, "");
+    CU_ASSERT_EQUAL_FATAL(CX_ArrayStringGetCount(array), 1);
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(CX_ArrayStringGetStringAt(array, 0)), SL_StringGetString(string));
+    CX_ArrayStringDispose(array);
+
+    CX_StringDispose(string);
+    muntrace();
+}
+
 void test_CX_StringSplit() {
 
     CX_UTEST_INIT_TEST("CX_StringSplit");
@@ -506,7 +627,81 @@ void test_CX_StringSplitRegex() {
     CX_StringDispose(string);
 
     CX_StatusDispose(status);
-    muntrace();
+    CX_UTEST_END_TEST();
+}
+
+/**
+ * Check that the tokens of a SplitIndex object are the elements of an ArrayString object.
+ */
+
+void assertSameTokens(CX_SplitIndex inIndex, CX_ArrayString inArray) {
+    CU_ASSERT_EQUAL_FATAL(CX_SplitIndexGetCount(inIndex), CX_ArrayStringGetCount(inArray));
+    CX_SplitToken *tokens = CX_SplitIndexGetTokens(inIndex);
+    for (size_t i=0; i<CX_SplitIndexGetCount(inIndex); i++) {
+        char *expected = SL_StringGetString(CX_ArrayStringGetStringAt(inArray, i));
+        CU_ASSERT_EQUAL_FATAL(tokens[i].length, strlen(expected));
+        CU_ASSERT_EQUAL_FATAL(strncmp(inIndex->source + tokens[i].offset, expected, tokens[i].length), 0);
+        CX_String string = CX_SplitIndexGetStringAt(inIndex, i);
+        CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(string), expected);
+        CX_StringDispose(string);
+    }
+    CU_ASSERT_PTR_NULL_FATAL(CX_SplitIndexGetStringAt(inIndex, CX_SplitIndexGetCount(inIndex)));
+}
+
+void test_CX_StringSplitIndex() {
+
+    CX_UTEST_INIT_TEST("CX_StringSplitIndex");
+    mtrace();
+
+    char *texts[] = { "ABC\r\nDEF\r\nGHI", "ABC\r\nDEF\r\n", "ABC", "", "\r\n\r\n", "a,b,,c," };
+    char *delimiters[] = { "\r\n", ",", "\n" };
+    CX_Status status = CX_StatusCreate();
+    // The same SplitIndex object is used for all the strings.
+    CX_SplitIndex index = CX_SplitIndexCreate();
+    CU_ASSERT_PTR_NOT_NULL_FATAL(index);
+
+    for (int i=0; i<sizeof(texts)/sizeof(char*); i++) {
+        CX_String string = CX_StringCreate(texts[i]);
+        for (int j=0; j<sizeof(delimiters)/sizeof(char*); j++) {
+            CX_ArrayString array = CX_StringSplitChar(string, delimiters[j]);
+            CU_ASSERT_TRUE_FATAL(CX_StringSplitCharIndex(string, delimiters[j], index));
+            assertSameTokens(index, array);
+            CX_ArrayStringDispose(array);
+
+            array = CX_StringSplitRegex(string, delimiters[j], status);
+            CU_ASSERT_TRUE_FATAL(CX_StringSplitRegexIndex(string, delimiters[j], index, status));
+            CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+            assertSameTokens(index, array);
+            CX_ArrayStringDispose(array);
+        }
+        CX_StringDispose(string);
+    }
+
+    // A large string.
+    CX_String string = CX_StringCreate(NULL);
+    for (int i=0; i<100000; i++) {
+        CX_StringAppendFmt(string, "%d;", i);
+    }
+    CU_ASSERT_TRUE_FATAL(CX_StringSplitCharIndex(string, ";", index));
+    CU_ASSERT_EQUAL_FATAL(CX_SplitIndexGetCount(index), 100001);
+    CX_String token = CX_SplitIndexGetStringAt(index, 54321);
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(token), "54321");
+    CX_StringDispose(token);
+    CU_ASSERT_EQUAL_FATAL(CX_SplitIndexGetTokens(index)[100000].length, 0);
+
+    // Special cases: no delimiter, a regex that matches the empty string, an invalid regex.
+    CU_ASSERT_TRUE_FATAL(CX_StringSplitCharIndex(string, "", index));
+    CU_ASSERT_EQUAL_FATAL(CX_SplitIndexGetCount(index), 1);
+    CU_ASSERT_EQUAL_FATAL(CX_SplitIndexGetTokens(index)[0].length, CX_StringLength(string));
+    CU_ASSERT_TRUE_FATAL(CX_StringSplitRegexIndex(string, ";*", index, status));
+    CU_ASSERT_EQUAL_FATAL(CX_SplitIndexGetCount(index), 1);
+    CU_ASSERT_FALSE_FATAL(CX_StringSplitRegexIndex(string, "(", index, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+    CX_StringDispose(string);
+
+    CX_SplitIndexDispose(index);
+    CX_StatusDispose(status);
+    CX_UTEST_END_TEST();
 }
 
 void test_CX_StringReplaceRegexChar() {
@@ -566,7 +761,7 @@ void test_CX_StringReplaceRegexChar() {
     CX_StringDispose(result);
 
     CX_StatusDispose(status);
-    muntrace();
+    CX_UTEST_END_TEST();
 }
 
 void test_CX_StringReplaceRegex() {
@@ -633,7 +828,7 @@ void test_CX_StringReplaceRegex() {
     CX_StringDispose(result);
 
     CX_StatusDispose(status);
-    muntrace();
+    CX_UTEST_END_TEST();
 }
 void test_CX_StringLinearize() {
 
@@ -822,9 +1017,13 @@ int main (int argc, char *argv[])
         &test_CX_StringDup,
         &test_CX_StringLength,
         &test_CX_StringAppend,
+        &test_CX_StringAppendGrowth,
+        &test_CX_StringSmall,
         &test_CX_StringSplitChar,
+        &test_CX_StringSplitCharSearch,
         &test_CX_StringSplit,
         &test_CX_StringSplitRegex,
+        &test_CX_StringSplitIndex,
         &test_CX_StringReplaceRegexChar,
         &test_CX_StringReplaceRegex,
         &test_CX_StringPrependChar,
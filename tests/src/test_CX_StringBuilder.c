@@ -0,0 +1,156 @@
+#include <mcheck.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "CX_UTest.h"
+#include "CUnit/CUnit.h"
+#include "CUnit/Basic.h"
+#include "CX_String.h"
+#include "CX_StringBuilder.h"
+
+// Define mandatory callbacks.
+int init_suite(void) {
+    CX_UTEST_INIT_ALL("src/CX_StringBuilder.c");
+    return 0;
+}
+
+int clean_suite(void) {
+    return 0;
+}
+
+void test_CX_StringBuilderAppendPrepend() {
+    CX_UTEST_INIT_TEST("CX_StringBuilderAppendPrepend");
+    mtrace();
+
+    CX_StringBuilder builder = CX_StringBuilderCreate(0);
+    CU_ASSERT_NOT_EQUAL_FATAL(builder, NULL);
+    CU_ASSERT_EQUAL_FATAL(CX_StringBuilderGetLength(builder), 0);
+
+    // Build "0 1 2 ... 9999" front to back, and then append a suffix.
+    char buffer[32];
+    for (int i = 9999; i >= 0; i--) {
+        sprintf(buffer, i > 0 ? " %d" : "%d", i);
+        CU_ASSERT_TRUE_FATAL(CX_StringBuilderPrependChar(builder, buffer));
+    }
+    CX_String suffix = CX_StringCreate(" end");
+    CU_ASSERT_TRUE_FATAL(CX_StringBuilderAppendString(builder, suffix));
+    CU_ASSERT_TRUE_FATAL(CX_StringBuilderPrepend(builder, "begin ", 6));
+    CX_StringDispose(suffix);
+
+    CX_StringBuilder expected = CX_StringBuilderCreate(16);
+    CU_ASSERT_TRUE_FATAL(CX_StringBuilderAppendChar(expected, "begin "));
+    for (int i = 0; i < 10000; i++) {
+        sprintf(buffer, i > 0 ? " %d" : "%d", i);
+        CU_ASSERT_TRUE_FATAL(CX_StringBuilderAppendChar(expected, buffer));
+    }
+    CU_ASSERT_TRUE_FATAL(CX_StringBuilderAppend(expected, " end", 4));
+    CU_ASSERT_EQUAL_FATAL(CX_StringBuilderGetLength(builder), CX_StringBuilderGetLength(expected));
+    CU_ASSERT_EQUAL_FATAL(memcmp(CX_StringBuilderGetChars(builder), CX_StringBuilderGetChars(expected),
+                                 CX_StringBuilderGetLength(builder)), 0);
+
+    // The buffer is handed over to the String object, and the StringBuilder object can be used again.
+    size_t length = CX_StringBuilderGetLength(builder);
+    CX_String string = CX_StringBuilderFinish(builder);
+    CU_ASSERT_NOT_EQUAL_FATAL(string, NULL);
+    CU_ASSERT_EQUAL_FATAL(CX_StringLength(string), length);
+    CU_ASSERT_EQUAL_FATAL(strlen(SL_StringGetString(string)), length);
+    CU_ASSERT_EQUAL_FATAL(strncmp(SL_StringGetString(string), "begin 0 1 2 ", 12), 0);
+    CU_ASSERT_TRUE_FATAL(CX_StringAppendChar(string, "!"));
+    CU_ASSERT_EQUAL_FATAL(strcmp(SL_StringGetString(string) + length - 8, "9999 end!"), 0);
+    CX_StringDispose(string);
+    CU_ASSERT_EQUAL_FATAL(CX_StringBuilderGetLength(builder), 0);
+
+    CU_ASSERT_TRUE_FATAL(CX_StringBuilderAppendChar(builder, "abc"));
+    CU_ASSERT_TRUE_FATAL(CX_StringBuilderPrependChar(builder, "xyz"));
+    string = CX_StringBuilderFinish(builder);
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(string), "xyzabc");
+    CX_StringDispose(string);
+
+    // An empty StringBuilder object gives an empty string.
+    string = CX_StringBuilderFinish(builder);
+    CU_ASSERT_STRING_EQUAL_FATAL(SL_StringGetString(string), "");
+    CX_StringDispose(string);
+
+    CX_StringBuilderDispose(expected);
+    CX_StringBuilderDispose(builder);
+    muntrace();
+}
+
+void test_CX_StringBuilderWrite() {
+    CX_UTEST_INIT_TEST("CX_StringBuilderWrite");
+    mtrace();
+
+    const char *path = "/tmp/test_CX_StringBuilderWrite.txt";
+    CX_Status status = CX_StatusCreate();
+    CX_StringBuilder builder = CX_StringBuilderCreate(4);
+    CU_ASSERT_TRUE_FATAL(CX_StringBuilderAppendChar(builder, "world"));
+    CU_ASSERT_TRUE_FATAL(CX_StringBuilderPrependChar(builder, "hello "));
+    CX_StringBuilderClear(builder);
+    CU_ASSERT_EQUAL_FATAL(CX_StringBuilderGetLength(builder), 0);
+    CU_ASSERT_TRUE_FATAL(CX_StringBuilderAppendChar(builder, "line\n"));
+    CU_ASSERT_TRUE_FATAL(CX_StringBuilderPrependChar(builder, "first "));
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    CU_ASSERT_TRUE_FATAL(fd >= 0);
+    CU_ASSERT_TRUE_FATAL(CX_StringBuilderWrite(builder, fd, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsSuccess(status));
+    close(fd);
+
+    char content[32] = { 0 };
+    FILE *file = fopen(path, "r");
+    CU_ASSERT_NOT_EQUAL_FATAL(file, NULL);
+    CU_ASSERT_EQUAL_FATAL(fread(content, 1, sizeof(content) - 1, file), 11);
+    fclose(file);
+    CU_ASSERT_STRING_EQUAL_FATAL(content, "first line\n");
+    remove(path);
+
+    // An invalid file descriptor.
+    CU_ASSERT_FALSE_FATAL(CX_StringBuilderWrite(builder, -1, status));
+    CU_ASSERT_TRUE_FATAL(CX_StatusIsFailure(status));
+
+    CX_StringBuilderDispose(builder);
+    CX_StatusDispose(status);
+    muntrace();
+}
+
+int main (int argc, char *argv[])
+{
+    printf("\n=== %s ===\n", argv[0]);
+
+    void (*functions[])(void) = {
+        &test_CX_StringBuilderAppendPrepend,
+        &test_CX_StringBuilderWrite
+    };
+
+    CU_pSuite pSuite1 = NULL;
+
+    // Initialize CUnit test registry.
+    if (CUE_SUCCESS != CU_initialize_registry()) {
+        return CU_get_error();
+    }
+
+    // Add the first tests suite to registry.
+    pSuite1 = CU_add_suite("Test Suite #1", init_suite, clean_suite);
+    if (NULL == pSuite1) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // Add functions in the tests suite.
+    for (int i=0; i < sizeof(functions)/sizeof(void (*)(void)); i++) {
+        if ((NULL == CU_add_test(pSuite1, "\n\nTesting\n\n", functions[i]))) {
+            CU_cleanup_registry();
+            return CU_get_error();
+        }
+    }
+
+    // OUTPUT to the screen
+    CU_basic_run_tests();
+
+    //Cleaning the Registry
+    CU_cleanup_registry();
+
+    CX_UTEST_END_TEST_SUITE;
+}
@@ -34,7 +34,7 @@ void test_CX_TemplateProcess_ok1() {
     char *result = CX_TemplateProcess(template, tags);
     CU_ASSERT_EQUAL_FATAL(strcmp(result, expectedResult), 0);
     CX_TemplateDispose(template);
-    muntrace();
+    CX_UTEST_END_TEST();
 }
 
 void test_CX_TemplateProcess_ok2() {
@@ -46,7 +46,7 @@ void test_CX_TemplateProcess_ok2() {
     char *result = CX_TemplateProcess(template, tags);
     CU_ASSERT_EQUAL_FATAL(strcmp(result, expectedResult), 0);
     CX_TemplateDispose(template);
-    muntrace();
+    CX_UTEST_END_TEST();
 }
 
 void test_CX_TemplateProcess_ok3() {
@@ -58,7 +58,7 @@ void test_CX_TemplateProcess_ok3() {
     char *result = CX_TemplateProcess(template, tags);
     CU_ASSERT_EQUAL_FATAL(strcmp(result, expectedResult), 0);
     CX_TemplateDispose(template);
-    muntrace();
+    CX_UTEST_END_TEST();
 }
 
 void test_CX_TemplateProcess_ok4() {
@@ -70,7 +70,7 @@ void test_CX_TemplateProcess_ok4() {
     char *result = CX_TemplateProcess(template, tags);
     CU_ASSERT_EQUAL_FATAL(strcmp(result, expectedResult), 0);
     CX_TemplateDispose(template);
-    muntrace();
+    CX_UTEST_END_TEST();
 }
 
 void test_CX_TemplateProcess_ko1() {
@@ -81,7 +81,7 @@ void test_CX_TemplateProcess_ko1() {
     char *result = CX_TemplateProcess(template, tags);
     CU_ASSERT_PTR_NULL_FATAL(result);
     CX_TemplateDispose(template);
-    muntrace();
+    CX_UTEST_END_TEST();
 }
 
 void test_CX_TemplateProcess_ko2() {
@@ -92,7 +92,7 @@ void test_CX_TemplateProcess_ko2() {
     char *result = CX_TemplateProcess(template, tags);
     CU_ASSERT_PTR_NULL_FATAL(result);
     CX_TemplateDispose(template);
-    muntrace();
+    CX_UTEST_END_TEST();
 }
 
 int main (int argc, char *argv[])